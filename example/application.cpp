@@ -19,18 +19,22 @@
 #include "composite.h"
 #include <decof/all.h>
 #include <decof/asio_tick/asio_tick.h>
+#include <decof/binary/pubsub_context.h>
 #include <decof/cli/clisrv_context.h>
 #include <decof/cli/pubsub_context.h>
 #include <decof/client_context/generic_tcp_server.h>
 #include <decof/scgi/scgi_context.h>
 #include <boost/asio/steady_timer.hpp>
 #include <boost/bind.hpp>
+#include <algorithm>
+#include <chrono>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <thread>
+#include <vector>
 
 using namespace decof;
 
@@ -87,7 +91,7 @@ std::string time_parameter::external_value() const
 
 void exit_event::signal()
 {
-    application::instance().strand().get_io_service().stop();
+    application::instance().strand().context().stop();
 }
 
 void cout_parameter::value(const std::string& value)
@@ -163,6 +167,12 @@ struct ip_address_parameter : public external_readwrite_parameter<std::string>
 //  | |-- summand1
 //  | |-- summand2
 //  | |-- sum
+//  |-- connections: node (r)
+//  | |-- cmd|mon|bin|scgi: node (r)
+//  | | |-- connections: int (r)
+//  | | |-- rejected-connections: int (r)
+//  | | |-- reaped-connections: int (r)
+//  |-- stats: node (r), see statistics_node
 
 object_dictionary                  obj_dict("example");
 my_managed_readwrite_parameter     enable_param("enabled", &obj_dict, "false");
@@ -191,6 +201,12 @@ node                                                                   writeonly
 cout_parameter                                                         cout_param("string", &writeonly_node);
 cout_tuple_parameter                                                   cout_tuple_param("tuple", &writeonly_node);
 composite                                                              comp("composite", &obj_dict);
+node                                                                   connections_node("connections", &obj_dict);
+node                                                                   cmd_connections_node("cmd", &connections_node);
+node                                                                   mon_connections_node("mon", &connections_node);
+node                                                                   bin_connections_node("bin", &connections_node);
+node                                                                   scgi_connections_node("scgi", &connections_node);
+statistics_node                                                        stats_node("stats", &obj_dict);
 auto background_work = background_worker::create("background_work", &obj_dict);
 
 } // Anonymous namespace
@@ -218,29 +234,51 @@ int application::run(int, char*[])
             return false;
         });
 
+    // Enable change journal for resumable subscriptions
+    obj_dict.journal().capacity(4096);
+
+    // Count parameter accesses for the 'heat' report
+    obj_dict.heat().enabled(true);
+
     // Setup request/respone CLI context
     boost::asio::ip::tcp::endpoint          cmd_endpoint(boost::asio::ip::tcp::v4(), 1998);
     generic_tcp_server<cli::clisrv_context> conn_mgr_cmd(obj_dict, strand_, cmd_endpoint);
+    conn_mgr_cmd.expose_connection_counts(&cmd_connections_node);
     conn_mgr_cmd.preload();
 
     // Setup publish/subscribe CLI context
     boost::asio::ip::tcp::endpoint          mon_endpoint(boost::asio::ip::tcp::v4(), 1999);
     generic_tcp_server<cli::pubsub_context> conn_mgr_mon(obj_dict, strand_, mon_endpoint);
+    conn_mgr_mon.expose_connection_counts(&mon_connections_node);
     conn_mgr_mon.preload();
 
+    // Setup binary publish/subscribe context
+    boost::asio::ip::tcp::endpoint             bin_endpoint(boost::asio::ip::tcp::v4(), 2000);
+    generic_tcp_server<binary::pubsub_context> conn_mgr_bin(obj_dict, strand_, bin_endpoint);
+    conn_mgr_bin.expose_connection_counts(&bin_connections_node);
+    conn_mgr_bin.preload();
+
     // Setup SCGI context
     boost::asio::ip::tcp::endpoint         scgi_endpoint(boost::asio::ip::tcp::v4(), 8081);
     generic_tcp_server<scgi::scgi_context> scgi_conn_mgr(obj_dict, strand_, scgi_endpoint);
+    scgi_conn_mgr.max_connections(256);
+    scgi_conn_mgr.idle_timeout(std::chrono::minutes(10));
+    scgi_conn_mgr.expose_connection_counts(&scgi_connections_node);
     scgi_conn_mgr.preload();
 
     // Setup asio_tick context
     asio_tick::asio_tick_context tick_ctx(obj_dict, strand_);
     tick_ctx.preload();
 
-    // Start two threads to show that handlers are serialized by strands
-    std::thread t([this]() { io_service_.run(); });
+    // Connections are served in parallel while object dictionary accesses
+    // are serialized by the strand
+    std::vector<std::thread> threads(std::max(1u, std::thread::hardware_concurrency()) - 1);
+    for (auto& t : threads)
+        t = std::thread([this]() { io_service_.run(); });
+
     io_service_.run();
-    t.join();
+    for (auto& t : threads)
+        t.join();
 
     return 0;
 }
@@ -260,6 +298,11 @@ asio_executor& application::executor()
     return executor_;
 }
 
-application::application() : io_service_(), strand_(io_service_), executor_(strand_)
+thread_pool_executor& application::pool()
+{
+    return pool_;
+}
+
+application::application() : io_service_(), strand_(io_service_), executor_(strand_), pool_()
 {
 }
@@ -18,6 +18,7 @@
 #define DECOF_EXAMPLE_APPLICATION_H
 
 #include <decof/asio_executor/asio_executor.h>
+#include <decof/asio_executor/thread_pool_executor.h>
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/strand.hpp>
 #include <memory>
@@ -46,12 +47,16 @@ class application
     boost::asio::io_service::strand& strand();
     decof::asio_executor&            executor();
 
+    /// Thread pool for background work.
+    decof::thread_pool_executor& pool();
+
   private:
     explicit application();
 
     boost::asio::io_service         io_service_;
     boost::asio::io_service::strand strand_;
     decof::asio_executor            executor_;
+    decof::thread_pool_executor     pool_;
 };
 
 #endif // DECOF_EXAMPLE_APPLICATION_H
@@ -16,6 +16,7 @@
 
 #define BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
 #define BOOST_THREAD_PROVIDES_EXECUTORS
+#define BOOST_THREAD_USES_MOVE
 
 #include "background_worker.h"
 #include "application.h"
@@ -42,7 +43,9 @@ void background_worker::start()
 
     ready_.value(false);
 
-    boost::async([self]() {
+    // Work in the background and apply the result on the object dictionary strand
+    auto& app = application::instance();
+    boost::async(app.pool(), []() {
         std::this_thread::sleep_for(std::chrono::seconds(5));
-    }).then(application::instance().executor(), [self](boost::unique_future<void>) { self->ready_.value(true); });
+    }).then(app.executor(), [self](boost::unique_future<void>) { self->ready_.value(true); });
 }
@@ -27,8 +27,8 @@
  * @brief Background worker example.
  *
  * This class runs an exemplary task (in fact, just a
- * @c std::this_thread::sleep_for) in a background thread andupdates a parameter
- * as a result using a Boost.Thread executor.
+ * @c std::this_thread::sleep_for) on the application's thread pool and updates
+ * a parameter as a result using a Boost.Thread executor.
  */
 class background_worker final : public decof::node, public std::enable_shared_from_this<background_worker>
 {
@@ -17,6 +17,7 @@
 #ifndef DECOF_ALL_H
 #define DECOF_ALL_H
 
+#include "change_journal.h"
 #include "encoding_hint.h"
 #include "event.h"
 #include "exceptions.h"
@@ -25,12 +26,14 @@
 #include "external_readwrite_handler_parameter.h"
 #include "external_readwrite_parameter.h"
 #include "handler_event.h"
+#include "heat_map.h"
 #include "managed_readonly_parameter.h"
 #include "managed_readwrite_handler_parameter.h"
 #include "managed_readwrite_parameter.h"
 #include "object.h"
 #include "object_dictionary.h"
 #include "object_visitor.h"
+#include "statistics_node.h"
 #include "types.h"
 #include "userlevel.h"
 #include "writeonly_handler_parameter.h"
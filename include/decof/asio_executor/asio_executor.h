@@ -17,6 +17,7 @@
 #ifndef DECOF_ASIO_EXECUTOR_H
 #define DECOF_ASIO_EXECUTOR_H
 
+#include "executor_metrics.h"
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/strand.hpp>
 #include <boost/noncopyable.hpp>
@@ -35,7 +36,8 @@ namespace decof {
  *
  * It can be used to asynchonously schedule work on the given
  * @c boost::asio::strand object using @c boost::async or
- * @c boost::future::then.
+ * @c boost::future::then. Use it to continue background work run by a
+ * thread_pool_executor on the object dictionary strand.
  */
 class asio_executor : boost::noncopyable
 {
@@ -98,16 +100,30 @@ class asio_executor : boost::noncopyable
         if (closed_)
             throw boost::sync_queue_is_closed();
 
-        strand_.post(move_handler(callable));
+        auto submission = statistics_.submitted();
+        strand_.post(move_handler([this, submission, f = std::forward<F>(callable)]() mutable {
+            statistics_.started(submission);
+            f();
+        }));
     }
 
     void close();
     bool closed();
+
+    /**
+     * @brief Runs one ready handler of the strand's I/O service.
+     *
+     * The handler need not stem from this executor. Returns @c false if
+     * invoked from within the strand, since strand handlers must not nest.
+     */
     bool try_executing_one();
 
+    executor_metrics metrics() const noexcept;
+
   private:
-    bool   closed_{false};
-    strand strand_;
+    bool                closed_{false};
+    strand              strand_;
+    executor_statistics statistics_;
 };
 
 } // namespace decof
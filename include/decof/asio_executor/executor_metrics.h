@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DECOF_EXECUTOR_METRICS_H
+#define DECOF_EXECUTOR_METRICS_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace decof {
+
+/// Snapshot of an executor's metrics.
+struct executor_metrics
+{
+    /// Number of closures submitted but not yet started.
+    std::size_t queue_depth = 0;
+
+    /// Number of closures started.
+    std::uint64_t executed = 0;
+
+    /// Number of closures taken from another worker's queue.
+    std::uint64_t stolen = 0;
+
+    /// Mean time from submission to start.
+    std::chrono::nanoseconds mean_latency{0};
+
+    /// Maximum time from submission to start.
+    std::chrono::nanoseconds max_latency{0};
+};
+
+/**
+ * @brief Thread-safe recorder of executor metrics.
+ *
+ * Executors call #submitted when a closure is queued and #started with the
+ * returned time point when it is about to run.
+ */
+class executor_statistics
+{
+  public:
+    using clock = std::chrono::steady_clock;
+
+    /// Records a submission and returns the submission time.
+    clock::time_point submitted() noexcept
+    {
+        queue_depth_.fetch_add(1, std::memory_order_relaxed);
+        return clock::now();
+    }
+
+    /// Records the start of a closure submitted at the given time.
+    void started(clock::time_point submission) noexcept
+    {
+        const std::uint64_t latency =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - submission).count();
+
+        queue_depth_.fetch_sub(1, std::memory_order_relaxed);
+        executed_.fetch_add(1, std::memory_order_relaxed);
+        total_latency_.fetch_add(latency, std::memory_order_relaxed);
+
+        std::uint64_t max = max_latency_.load(std::memory_order_relaxed);
+        while (latency > max && !max_latency_.compare_exchange_weak(max, latency, std::memory_order_relaxed)) {
+        }
+    }
+
+    /// Records that a closure was stolen from another worker's queue.
+    void stolen() noexcept
+    {
+        stolen_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    executor_metrics snapshot() const noexcept
+    {
+        executor_metrics retval;
+        retval.queue_depth = queue_depth_.load(std::memory_order_relaxed);
+        retval.executed    = executed_.load(std::memory_order_relaxed);
+        retval.stolen      = stolen_.load(std::memory_order_relaxed);
+        retval.max_latency = std::chrono::nanoseconds(max_latency_.load(std::memory_order_relaxed));
+        if (retval.executed != 0)
+            retval.mean_latency =
+                std::chrono::nanoseconds(total_latency_.load(std::memory_order_relaxed) / retval.executed);
+        return retval;
+    }
+
+  private:
+    std::atomic<std::size_t>   queue_depth_{0};
+    std::atomic<std::uint64_t> executed_{0};
+    std::atomic<std::uint64_t> stolen_{0};
+    std::atomic<std::uint64_t> total_latency_{0};
+    std::atomic<std::uint64_t> max_latency_{0};
+};
+
+} // namespace decof
+
+#endif // DECOF_EXECUTOR_METRICS_H
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DECOF_THREAD_POOL_EXECUTOR_H
+#define DECOF_THREAD_POOL_EXECUTOR_H
+
+#include "executor_metrics.h"
+#include <boost/noncopyable.hpp>
+#include <boost/thread/sync_queue.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace decof {
+
+/**
+ * @brief Work-stealing thread pool executor.
+ *
+ * This class models the Executor concept as specified in
+ * <a
+ * href="http://www.boost.org/doc/libs/1_64_0/doc/html/thread/synchronization.html#thread.synchronization.executors.ref.concept_executor">
+ * Boost.Thread</a> and is meant for background work that must not block the
+ * object dictionary strand, e.g., using @c boost::async. Apply results to
+ * parameters by continuing on an asio_executor using @c boost::future::then.
+ *
+ * Each worker thread owns a queue. Closures submitted from within a worker
+ * are queued in the worker's own queue and run last in, first out, while
+ * other closures are queued in a shared queue and run first in, first out
+ * once a worker has drained its own queue. Idle workers steal the oldest
+ * closures from the queues of other workers. Hence, closures spawned by
+ * workers are not executed in submission order.
+ */
+class thread_pool_executor : boost::noncopyable
+{
+    /// Type-erased move-only closure.
+    class work
+    {
+      public:
+        work() = default;
+
+        template <typename F, typename = std::enable_if_t<!std::is_same<std::decay_t<F>, work>::value>>
+        explicit work(F&& f) : impl_(std::make_unique<impl<std::decay_t<F>>>(std::forward<F>(f)))
+        {
+        }
+
+        void operator()()
+        {
+            impl_->run();
+        }
+
+      private:
+        struct base
+        {
+            virtual ~base() = default;
+            virtual void run() = 0;
+        };
+
+        template <typename F>
+        struct impl : base
+        {
+            explicit impl(F&& f) : f_(std::move(f))
+            {
+            }
+
+            explicit impl(const F& f) : f_(f)
+            {
+            }
+
+            void run() override
+            {
+                f_();
+            }
+
+            F f_;
+        };
+
+        std::unique_ptr<base> impl_;
+    };
+
+  public:
+    /// Starts the given number of worker threads.
+    explicit thread_pool_executor(std::size_t threads = std::thread::hardware_concurrency());
+
+    /// Closes the executor and waits for all queued closures to finish.
+    ~thread_pool_executor();
+
+    /**
+     * @brief Submit a callable to the executor.
+     *
+     * If the invoked callable throws an exception the executor will call
+     * @c std::terminate, as is the case with threads.
+     *
+     * @param callable The callable with signature @c void() to submit.
+     * @throw boost::sync_queue_is_closed if the executor was closed.
+     */
+    template <typename F>
+    void submit(F&& callable)
+    {
+        if (closed_)
+            throw boost::sync_queue_is_closed();
+
+        push(work(std::forward<F>(callable)));
+    }
+
+    /// Closes the executor for submissions. Queued closures are still run.
+    void close();
+    bool closed();
+
+    /// Runs a queued closure in the calling thread, if any.
+    bool try_executing_one();
+
+    /// Waits for the worker threads to finish after the executor was closed.
+    void join();
+
+    /// Returns the number of worker threads.
+    std::size_t size() const noexcept;
+
+    executor_metrics metrics() const noexcept;
+
+  private:
+    using clock = executor_statistics::clock;
+
+    struct worker_queue
+    {
+        std::mutex                                      mutex;
+        std::deque<std::pair<work, clock::time_point>> closures;
+    };
+
+    void push(work&& w);
+
+    /**
+     * @brief Takes a closure to be run.
+     *
+     * Prefers the calling worker's own queue, then the shared queue of
+     * external submissions and finally steals from the other workers.
+     *
+     * @param index The calling worker's index, or where to start stealing
+     * if not called by a worker.
+     */
+    bool take(std::size_t index, work& w, clock::time_point& submission);
+
+    void run(std::size_t index);
+
+    std::vector<std::unique_ptr<worker_queue>> queues_;
+    worker_queue                               submissions_;
+    std::vector<std::thread>                   threads_;
+
+    std::mutex               mutex_;
+    std::condition_variable  condition_;
+    std::atomic<bool>        closed_{false};
+    std::atomic<std::size_t> pending_{0};
+    executor_statistics      statistics_;
+};
+
+} // namespace decof
+
+#endif // DECOF_THREAD_POOL_EXECUTOR_H
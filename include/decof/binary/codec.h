@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DECOF_BINARY_CODEC_H
+#define DECOF_BINARY_CODEC_H
+
+#include <decof/byte_order.h>
+#include <decof/types.h>
+#include <cstdint>
+#include <string>
+
+namespace decof {
+
+namespace binary {
+
+/**
+ * @brief Type tags of the binary value encoding.
+ *
+ * Each value is encoded as a one byte type tag followed by the payload. All
+ * numbers are little endian.
+ *
+ * | Tag      | Payload                                                     |
+ * |----------|-------------------------------------------------------------|
+ * | boolean  | u8 (0 or 1)                                                 |
+ * | integer  | i64                                                         |
+ * | real     | IEEE 754 binary64                                           |
+ * | string   | u32 length, UTF-8 bytes                                     |
+ * | binary   | u32 length, bytes                                           |
+ * | sequence | element tag, u32 count, untagged elements                   |
+ * | tuple    | u32 count, tagged scalar elements                           |
+ *
+ * Sequences of booleans, integers and reals are thus transferred as raw
+ * arrays. Empty sequences use the element tag @c none.
+ */
+enum class type_tag : std::uint8_t {
+    none     = 0,
+    boolean  = 1,
+    integer  = 2,
+    real     = 3,
+    string   = 4,
+    binary   = 5,
+    sequence = 6,
+    tuple    = 7
+};
+
+/**
+ * @brief Binary value encoder.
+ *
+ * Appends the binary encoding of generic values to a string. Use it as
+ * visitor for @c std::visit.
+ */
+class encoder
+{
+  public:
+    explicit encoder(std::string& out);
+
+    void operator()(const value_t& arg) const;
+    void operator()(const scalar_t& arg) const;
+    void operator()(const sequence_t& arg) const;
+    void operator()(const tuple_t& arg) const;
+
+    void operator()(const boolean_t& arg) const;
+    void operator()(const integer_t& arg) const;
+    void operator()(const real_t& arg) const;
+    void operator()(const string_t& arg) const;
+    void operator()(const binary_t& arg) const;
+
+  private:
+    /// Appends the scalar payload without type tag.
+    void payload(const scalar_t& arg) const;
+
+    std::string& out_;
+};
+
+/**
+ * @brief Binary value decoder.
+ *
+ * Decodes values from the character range [first, last).
+ *
+ * @throw invalid_value_error in case of malformed input.
+ */
+class decoder
+{
+  public:
+    decoder(const char* first, const char* last);
+
+    /// Decodes the next value.
+    value_t value();
+
+    /// Returns the position of the next undecoded character.
+    const char* position() const;
+
+  private:
+    /// Decodes a scalar payload of the given type.
+    scalar_t scalar(type_tag tag);
+
+    /// Checks that at least @a n characters are left.
+    void require(std::size_t n) const;
+
+    template <typename T>
+    T read()
+    {
+        require(sizeof(T));
+        T retval = read_le<T>(pos_);
+        pos_ += sizeof(T);
+        return retval;
+    }
+
+    const char* pos_;
+    const char* last_;
+};
+
+} // namespace binary
+
+} // namespace decof
+
+#endif // DECOF_BINARY_CODEC_H
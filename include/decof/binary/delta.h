@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DECOF_BINARY_DELTA_H
+#define DECOF_BINARY_DELTA_H
+
+#include <decof/types.h>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace decof {
+
+namespace binary {
+
+/// Range of elements given by first index and element count.
+using element_range = std::pair<std::size_t, std::size_t>;
+
+/**
+ * @brief Determine the ranges of differing elements of two arrays.
+ *
+ * Both arrays consist of @a count elements of @a elem_size bytes. Equal
+ * regions are skipped blockwise so that the comparison vectorises well.
+ * Ranges separated by less than @a min_gap elements are merged.
+ */
+std::vector<element_range> changed_ranges(const char* lhs,
+                                          const char* rhs,
+                                          std::size_t count,
+                                          std::size_t elem_size,
+                                          std::size_t min_gap = 1);
+
+/**
+ * @brief Encode a patch between two encoded values.
+ *
+ * Patches are possible between binary encoded sequences of booleans,
+ * integers or reals and between binary encoded binary values of equal
+ * element count. The patch is encoded as value type tag, element type tag,
+ * u32 element count, u32 range count and for each range u32 first index,
+ * u32 element count and the raw elements.
+ *
+ * @param out The string the patch is appended to.
+ * @param previous The binary encoding of the previous value.
+ * @param current The binary encoding of the current value.
+ * @return @c false if no patch is possible or a patch would not be smaller
+ * than @a current. Nothing is appended in this case.
+ */
+bool encode_patch(std::string& out, const std::string& previous, const std::string& current);
+
+/**
+ * @brief Apply a patch to a value.
+ *
+ * @param value The value to be patched.
+ * @param first Start of the encoded patch.
+ * @param last End of the encoded patch.
+ * @throw invalid_value_error if the patch does not match the value.
+ */
+void apply_patch(value_t& value, const char* first, const char* last);
+
+} // namespace binary
+
+} // namespace decof
+
+#endif // DECOF_BINARY_DELTA_H
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DECOF_BINARY_PUBSUB_CONTEXT_H
+#define DECOF_BINARY_PUBSUB_CONTEXT_H
+
+#include <decof/cli/update_queue.h>
+#include <decof/client_context/client_context.h>
+#include <decof/client_context/flush_scheduler.h>
+#include <decof/client_context/output_buffer.h>
+#include <decof/client_context/stream_socket.h>
+#include <decof/types.h>
+#include <decof/userlevel.h>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/strand.hpp>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace decof {
+
+// Forward declaration(s)
+class object_dictionary;
+
+namespace binary {
+
+/**
+ * @brief Frame types of the binary publish/subscribe protocol.
+ *
+ * Each frame consists of a u32 little endian length, the one byte frame type
+ * and the frame body. The length covers frame type and body.
+ */
+enum class frame_type : std::uint8_t {
+    /// Client request with the parameter path as body.
+    subscribe = 0x01,
+
+    /// Client request with the parameter path as body.
+    unsubscribe = 0x02,
+
+    /// Client request with u8 option flags and u32 keyframe interval.
+    options = 0x03,
+
+    /// Assignment of a u32 parameter id to the subscribed parameter path.
+    announce = 0x81,
+
+    /// u32 parameter id, i64 timestamp in microseconds since epoch (UTC),
+    /// encoded value.
+    update = 0x82,
+
+    /// u32 error code and error message.
+    error = 0x83,
+
+    /// u32 parameter id, i64 timestamp in microseconds since epoch (UTC),
+    /// encoded patch (see encode_patch()).
+    patch = 0x84
+};
+
+/// Option flags of the options frame.
+enum option_flags : std::uint8_t {
+    /// Send patches instead of full values for sequences and binary values.
+    delta_updates = 0x01
+};
+
+/// Number of updates after which a full value is sent instead of a patch.
+constexpr std::uint32_t default_keyframe_interval = 100;
+
+/// Size of the frame header consisting of length and frame type.
+constexpr std::size_t frame_header_size = 5;
+
+/// Maximum size of client request frames.
+constexpr std::size_t max_request_size = 4096;
+
+/// Appends a frame header to @a out.
+void write_frame_header(std::string& out, frame_type type, std::size_t body_size);
+
+/**
+ * @brief Publish/subscribe context using the binary protocol.
+ *
+ * Offers the same subscribe/unsubscribe semantics as cli::pubsub_context but
+ * transfers updates as compact length-prefixed frames using the binary value
+ * encoding. Parameters are identified by ids that are announced on the first
+ * subscription.
+ */
+class pubsub_context : public client_context, public std::enable_shared_from_this<pubsub_context>
+{
+  public:
+    using strand_t = boost::asio::io_service::strand;
+    using socket_t = stream_socket;
+
+    /** @brief Constructor.
+     *
+     * @param strand Reference to the Boost.Asio strand object that serializes
+     * accesses to the object dictionary. Socket I/O, framing and encoding run
+     * on a strand of the context's own.
+     * @param socket Rvalue reference socket.
+     * @param od Reference to the object dictionary.
+     * @param userlevel The contexts default userlevel.
+     */
+    explicit pubsub_context(strand_t& strand, socket_t&& socket, object_dictionary& od, userlevel_t userlevel = Normal);
+
+    std::string connection_type() const final;
+    std::string remote_endpoint() const final;
+
+    void preload();
+
+  private:
+    /// Callback for read operations of the frame header.
+    void header_handler(const boost::system::error_code& error, std::size_t bytes_transferred);
+
+    /// Callback for read operations of the frame body.
+    void body_handler(const boost::system::error_code& error, std::size_t bytes_transferred);
+
+    /// Callback for write operations.
+    void write_handler(const boost::system::error_code& error, std::size_t bytes_transferred);
+
+    /// Boost.Signals2 slot function for parameter change notifications.
+    /// Runs on the object dictionary strand and hands the update over to the
+    /// connection strand.
+    void notify(const std::string& uri, const value_t& value);
+
+    /** Initiate chain of write operations for pending updates.
+     * @note Does nothing in case of no pending updates or in case a write
+     * operation is currently active. */
+    void preload_writing();
+
+    /// Closes the socket and delists client context from object dictionary.
+    void close();
+
+    /// Processes a request frame.
+    void process_request(frame_type type, const std::string& body);
+
+    /// Subscribes to a parameter in the object dictionary strand.
+    void subscribe(const std::string& uri);
+
+    /// Announces the parameter id of a subscribed parameter if new and
+    /// continues subscribing in the object dictionary strand.
+    void announce(const std::string& uri, const std::string& fq_name);
+
+    /// Unsubscribes from a parameter in the object dictionary strand.
+    void unsubscribe(const std::string& uri);
+
+    /// Queues an error frame.
+    void send_error(int code, const char* what);
+
+    /// Queues an error frame for the exception being handled from the object
+    /// dictionary strand.
+    void post_error();
+
+    /// Appends value or patch to #frame_ and returns the resulting frame type.
+    frame_type encode_value(std::uint32_t id, const value_t& value);
+
+    /// Delta encoding state per parameter.
+    struct delta_state
+    {
+        /// Binary encoding of the value last sent.
+        std::string encoded;
+
+        /// Number of patches sent since the last full value.
+        std::uint32_t patches = 0;
+    };
+
+    strand_t&        dictionary_strand_;
+    strand_t         strand_;
+    flush_scheduler& flush_scheduler_;
+    socket_t         socket_;
+    std::string      remote_endpoint_;
+    std::string      connection_type_;
+
+    std::array<char, frame_header_size> header_;
+    std::vector<char>                   inbuf_;
+    output_buffer                       outbuf_;
+    std::string                         frame_;
+
+    size_t socket_send_buf_size_;
+
+    cli::update_queue pending_updates_;
+    bool              writing_active_ = false;
+
+    /// Parameter ids by fully qualified parameter name.
+    std::map<std::string, std::uint32_t> ids_;
+
+    /// Negotiated delta encoding options.
+    bool          delta_updates_     = false;
+    std::uint32_t keyframe_interval_ = default_keyframe_interval;
+
+    std::map<std::uint32_t, delta_state> delta_states_;
+    std::string                          encoded_;
+};
+
+} // namespace binary
+
+} // namespace decof
+
+#endif // DECOF_BINARY_PUBSUB_CONTEXT_H
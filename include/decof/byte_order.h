@@ -14,16 +14,17 @@
  * limitations under the License.
  */
 
-#ifndef DECOF_SCGI_ENDIAN_H
-#define DECOF_SCGI_ENDIAN_H
+#ifndef DECOF_BYTE_ORDER_H
+#define DECOF_BYTE_ORDER_H
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
 
 namespace decof {
 
-namespace scgi {
-
 template <typename T>
 T little_endian_to_native(const T& value)
 {
@@ -60,8 +61,27 @@ T native_to_little_endian(const T& value)
     return retval;
 }
 
-} // namespace scgi
+/// Appends @a value in little endian byte order to @a out.
+template <typename T>
+void write_le(std::string& out, T value)
+{
+    static_assert(std::is_arithmetic<T>::value, "Arithmetic type required");
+
+    value = native_to_little_endian(value);
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/// Reads a little endian value from @a in, which need not be aligned.
+template <typename T>
+T read_le(const char* in)
+{
+    static_assert(std::is_arithmetic<T>::value, "Arithmetic type required");
+
+    T value;
+    std::memcpy(&value, in, sizeof(T));
+    return little_endian_to_native(value);
+}
 
 } // namespace decof
 
-#endif // DECOF_SCGI_ENDIAN_H
+#endif // DECOF_BYTE_ORDER_H
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DECOF_CHANGE_JOURNAL_H
+#define DECOF_CHANGE_JOURNAL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+namespace decof {
+
+/**
+ * @brief Bounded journal of parameter value changes.
+ *
+ * The journal assigns a monotonically increasing sequence number to each
+ * recorded change and retains the most recent changes up to its capacity.
+ * Clients that lost their connection can use it to find out which parameters
+ * changed after the last sequence number they have seen.
+ *
+ * Sequence numbers start at the time the journal was enabled in microseconds
+ * since epoch, so that numbers handed out by a previous server instance are
+ * never mistaken for being covered by the journal.
+ *
+ * A journal with a capacity of zero is disabled and records nothing.
+ */
+class change_journal
+{
+  public:
+    using sequence_type = std::uint64_t;
+
+    struct entry
+    {
+        sequence_type sequence;
+        std::string   uri;
+    };
+
+    explicit change_journal(std::size_t capacity = 0);
+
+    /// Returns the maximum number of retained entries.
+    std::size_t capacity() const;
+
+    /**
+     * @brief Set the maximum number of retained entries.
+     *
+     * Excess entries are dropped starting with the oldest one. A capacity of
+     * zero disables the journal.
+     */
+    void capacity(std::size_t capacity);
+
+    /// Returns whether the journal records changes.
+    bool enabled() const;
+
+    /**
+     * @brief Record a value change.
+     *
+     * @param uri The fully qualified name of the changed parameter.
+     * @return The sequence number assigned to the change or zero if the
+     * journal is disabled.
+     */
+    sequence_type record(const std::string& uri);
+
+    /// Returns the sequence number of the most recent change.
+    sequence_type last_sequence() const;
+
+    /**
+     * @brief Check whether all changes after the given sequence number are
+     * still retained.
+     *
+     * If this function returns @c false the journal has overflowed since
+     * @a since (or @a since stems from another server instance) and a client
+     * requires a full resync.
+     */
+    bool covers(sequence_type since) const;
+
+    /**
+     * @brief Check whether a parameter changed after the given sequence number.
+     *
+     * @pre @c covers(since) returns @c true.
+     */
+    bool changed_since(std::string_view uri, sequence_type since) const;
+
+    /// Invokes @a f for each retained entry newer than @a since in order.
+    template <typename F>
+    void for_each_since(sequence_type since, F f) const
+    {
+        auto it = entries_.cend();
+        while (it != entries_.cbegin() && std::prev(it)->sequence > since)
+            --it;
+
+        for (; it != entries_.cend(); ++it)
+            f(*it);
+    }
+
+  private:
+    std::size_t       capacity_;
+    sequence_type     last_sequence_;
+    std::deque<entry> entries_;
+};
+
+} // namespace decof
+
+#endif // DECOF_CHANGE_JOURNAL_H
@@ -18,6 +18,7 @@
 #define DECOF_CLI_CONTEXT_BASE_H
 
 #include <decof/client_context/client_context.h>
+#include <decof/statistics.h>
 #include <decof/userlevel.h>
 #include <functional>
 #include <string>
@@ -29,7 +30,7 @@ namespace cli {
 class cli_context_base : public client_context
 {
   public:
-    enum class request_t { get, set, signal, browse, tree, subscribe, unsubscribe };
+    using request_t = request_type;
 
     using userlevel_cb_t     = std::function<bool(const client_context&, userlevel_t, const std::string&)>;
     using connect_event_cb_t = std::function<void(bool pubsub, bool connect, const std::string& peer_address)>;
@@ -62,6 +63,10 @@ class cli_context_base : public client_context
     static void install_request_callback(const request_cb_t& request_cb) noexcept;
 
   protected:
+    /// Counts the request in the framework statistics and invokes the request
+    /// callback if installed.
+    void report_request(request_t request_type, const std::string& request) const;
+
     static userlevel_cb_t     userlevel_cb_;
     static connect_event_cb_t connect_event_cb_;
     static request_cb_t       request_cb_;
@@ -18,29 +18,32 @@
 #define DECOF_CLI_CLISRV_CONTEXT_H
 
 #include <boost/asio/io_service.hpp>
-#include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/strand.hpp>
 #include <boost/asio/streambuf.hpp>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <string>
 
-#include <decof/cli/cli_context_base.h>
+#include <decof/cli/clisrv_context_base.h>
+#include <decof/client_context/output_buffer.h>
+#include <decof/client_context/stream_socket.h>
 
 namespace decof {
 
 namespace cli {
 
-class clisrv_context : public cli_context_base, public std::enable_shared_from_this<clisrv_context>
+class clisrv_context : public clisrv_context_base, public std::enable_shared_from_this<clisrv_context>
 {
   public:
     using strand_t = boost::asio::io_service::strand;
-    using socket_t = boost::asio::ip::tcp::socket;
+    using socket_t = stream_socket;
 
     /** @brief Constructor.
      *
-     * @param strand Reference to a Boost.Asio strand object used to dispatch
-     * the handlers.
+     * @param strand Reference to the Boost.Asio strand object that serializes
+     * accesses to the object dictionary. Socket I/O runs on a strand of the
+     * context's own.
      * @param socket Rvalue reference socket.
      * @param od Reference to the object dictionary.
      * @param userlevel The contexts default userlevel.
@@ -53,26 +56,27 @@ class clisrv_context : public cli_context_base, public std::enable_shared_from_t
 
   private:
     /// Callback for boost::asio write operations.
-    void write_handler(const boost::system::error_code& error, std::size_t);
+    void write_handler(const boost::system::error_code& error, std::size_t bytes_transferred);
 
     /** @brief Callback for boost::asio read operations.
      *
-     * Parses and evaluates CLI client/server command lines. Expects
-     * command lines like: <operation> [ <uri> [ <value-string> ]].
-     * Operation must be one of: get, param-ref, set, param-set!, signal, exec,
-     * browse, param-disp. */
+     * Parses the received command line and hands it over to the object
+     * dictionary strand for evaluation. */
     void read_handler(const boost::system::error_code& error, std::size_t bytes_transferred);
 
+    /// Encodes the reply on the connection strand and sends it.
+    void send_reply(reply rep, std::chrono::steady_clock::time_point received);
+
     /// Closes the socket and delists client context from object dictionary.
     void disconnect();
 
-    /// Processes CLI requests.
-    void process_request(std::string request);
-
-    strand_t&              strand_;
+    strand_t&              dictionary_strand_;
+    strand_t               strand_;
     socket_t               socket_;
+    std::string            remote_endpoint_;
+    std::string            connection_type_;
     boost::asio::streambuf inbuf_;
-    boost::asio::streambuf outbuf_;
+    output_buffer          outbuf_;
 };
 
 } // namespace cli
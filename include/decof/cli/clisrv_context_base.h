@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DECOF_CLI_CLISRV_CONTEXT_BASE_H
+#define DECOF_CLI_CLISRV_CONTEXT_BASE_H
+
+#include <decof/cli/cli_context_base.h>
+#include <decof/client_context/output_buffer.h>
+#include <decof/heat_map.h>
+#include <decof/types.h>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace decof {
+
+namespace cli {
+
+/**
+ * @brief Base class for CLI client/server contexts.
+ *
+ * Implements the evaluation of CLI command lines independent of the way the
+ * connection is driven, so that callback and coroutine based contexts share
+ * the protocol implementation.
+ */
+class clisrv_context_base : public cli_context_base
+{
+  public:
+    using cli_context_base::cli_context_base;
+
+  protected:
+    /// CLI command line split into its operation and arguments.
+    struct request
+    {
+        /// Command line as received, for reporting.
+        std::string line;
+
+        /// Operation in lower case.
+        std::string op;
+
+        /// Parameter URI without optional quote.
+        std::string uri;
+
+        /// Value given with the command, if any.
+        std::optional<value_t> value;
+
+        /// Requested userlevel of 'exec change-ul'.
+        userlevel_t userlevel = Normal;
+
+        /// Password of 'exec change-ul'.
+        std::string password;
+
+        /// Number of records reported by 'heat'.
+        std::size_t count = 0;
+
+        /// Sort order of 'heat'.
+        heat_map::sort_key sort_key = heat_map::sort_key::count;
+    };
+
+    /// Outcome of a CLI request, ready to be encoded into a response.
+    struct reply
+    {
+        /// Empty command line, which is not answered.
+        bool ignored = false;
+
+        /// Value to be encoded.
+        std::optional<value_t> value;
+
+        /// Records reported by 'heat'.
+        std::vector<heat_map::record> heat;
+
+        /// Response text handed over verbatim.
+        std::string text;
+
+        /// Error line, if the request failed.
+        std::string error;
+    };
+
+    /// Appends the greeting and the first prompt to @a outbuf.
+    static void append_greeting(output_buffer& outbuf);
+
+    /** @brief Parses a CLI command line.
+     *
+     * Expects command lines like: <operation> [ <uri> [ <value-string> ]].
+     * Operation must be one of: get, param-ref, set, param-set!, signal, exec,
+     * browse, param-disp, tree, heat.
+     *
+     * Does not access the object dictionary and may thus run on the
+     * connection strand.
+     *
+     * @param line The command line including the line terminator.
+     * @param req Receives the parsed request.
+     * @param rep Receives the reply if the request is not to be evaluated.
+     * @return Whether the request must be passed to #evaluate_request.
+     */
+    static bool parse_request(const std::string& line, request& req, reply& rep);
+
+    /// Evaluates a parsed request on the object dictionary strand.
+    void evaluate_request(const request& req, reply& rep);
+
+    /// Appends the response and the next prompt to @a outbuf.
+    static void encode_reply(reply rep, output_buffer& outbuf);
+};
+
+} // namespace cli
+
+} // namespace decof
+
+#endif // DECOF_CLI_CLISRV_CONTEXT_BASE_H
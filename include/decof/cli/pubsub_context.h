@@ -17,16 +17,20 @@
 #ifndef DECOF_CLI_PUBSUB_CONTEXT_H
 #define DECOF_CLI_PUBSUB_CONTEXT_H
 
-#include "update_container.h"
+#include "update_queue.h"
+#include <decof/change_journal.h>
 #include <decof/cli/cli_context_base.h>
+#include <decof/client_context/flush_scheduler.h>
+#include <decof/client_context/output_buffer.h>
+#include <decof/client_context/stream_socket.h>
 #include <decof/types.h>
 #include <decof/userlevel.h>
 #include <boost/any.hpp>
 #include <boost/asio/io_service.hpp>
-#include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/strand.hpp>
 #include <boost/asio/streambuf.hpp>
 #include <memory>
+#include <optional>
 #include <string>
 
 namespace decof {
@@ -40,12 +44,13 @@ class pubsub_context : public cli_context_base, public std::enable_shared_from_t
 {
   public:
     using strand_t = boost::asio::io_service::strand;
-    using socket_t = boost::asio::ip::tcp::socket;
+    using socket_t = stream_socket;
 
     /** @brief Constructor.
      *
-     * @param strand Reference to a Boost.Asio strand object used to dispatch
-     * the handlers.
+     * @param strand Reference to the Boost.Asio strand object that serializes
+     * accesses to the object dictionary. Socket I/O, parsing and encoding run
+     * on a strand of the context's own.
      * @param socket Rvalue reference socket.
      * @param od Reference to the object dictionary.
      * @param userlevel The contexts default userlevel.
@@ -67,6 +72,9 @@ class pubsub_context : public cli_context_base, public std::enable_shared_from_t
     /**
      * @brief Boost.Signals2 slot function for parameter change notifications.
      *
+     * Runs on the object dictionary strand and hands the update over to the
+     * connection strand.
+     *
      * @param uri The fully qualified name of the parameter which value is
      * updated.
      * @param value The new value. */
@@ -80,18 +88,37 @@ class pubsub_context : public cli_context_base, public std::enable_shared_from_t
     /// Closes the socket and delists client context from object dictionary.
     void close();
 
-    /// Processes CLI requests.
+    /// Processes CLI requests on the object dictionary strand.
     void process_request(std::string request);
 
-    strand_t&              strand_;
+    /// Hands an error message over to the connection strand.
+    void send_error(std::string message);
+
+    strand_t&              dictionary_strand_;
+    strand_t               strand_;
+    flush_scheduler&       flush_scheduler_;
     socket_t               socket_;
     boost::asio::streambuf inbuf_;
-    boost::asio::streambuf outbuf_;
+    output_buffer          outbuf_;
+
+    size_t      socket_send_buf_size_;
+    std::string remote_endpoint_;
+    std::string connection_type_;
+
+    update_queue pending_updates_;
+    bool         writing_active_ = false;
+
+    /// Sequence number given with the last 'resume' request, if any.
+    std::optional<change_journal::sequence_type> resume_sequence_;
 
-    size_t socket_send_buf_size_;
+    /// Drop notifications while subscribing to a parameter that did not
+    /// change since #resume_sequence_.
+    bool suppress_notifications_ = false;
 
-    update_container pending_updates_;
-    bool             writing_active_ = false;
+    /// Whether the client subscribed to the 'seq' pseudo parameter.
+    /// These members are owned by the connection strand.
+    bool                          report_sequence_   = false;
+    change_journal::sequence_type reported_sequence_ = 0;
 };
 
 } // namespace cli
@@ -19,7 +19,9 @@
 
 #include <decof/types.h>
 #include <chrono>
+#include <cstddef>
 #include <map>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 
@@ -59,6 +61,9 @@ class update_container
 
     bool empty() const noexcept;
 
+    /// Returns the number of elements.
+    std::size_t size() const noexcept;
+
   private:
     template <template <typename K, typename V, typename C, typename A> class Map, typename Key>
     struct mapped_type
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DECOF_CLI_UPDATE_QUEUE_H
+#define DECOF_CLI_UPDATE_QUEUE_H
+
+#include "update_container.h"
+#include <cstdint>
+#include <mutex>
+#include <tuple>
+
+namespace decof {
+
+namespace cli {
+
+/**
+ * @brief Thread-safe hand-off of publish updates between strands.
+ *
+ * Updates are pushed by the strand of the object dictionary and popped by
+ * the strand of a connection. Updates of the same parameter are coalesced
+ * like with #update_container.
+ *
+ * The queue keeps track of whether the consumer is scheduled, so that the
+ * object dictionary strand posts at most one consumer invocation at any
+ * time.
+ *
+ * Each update may carry the journal sequence number of the change. The queue
+ * reports the highest of these numbers once all updates pushed with it have
+ * been popped, so that the consumer never announces a sequence number ahead
+ * of the updates it has handed over.
+ *
+ * The number of queued updates is accounted for in the framework statistics
+ * as update backlog.
+ */
+class update_queue
+{
+  public:
+    using key_type      = update_container::key_type;
+    using time_point    = update_container::time_point;
+    using update        = std::tuple<key_type, value_t, time_point>;
+    using sequence_type = std::uint64_t;
+
+    update_queue() = default;
+    ~update_queue();
+
+    update_queue(const update_queue&) = delete;
+    update_queue& operator=(const update_queue&) = delete;
+
+    /**
+     * @brief Push new element to the queue.
+     *
+     * @param uri Parameter URI.
+     * @param value New parameter value.
+     * @param sequence Journal sequence number of the change, if any.
+     * @return Whether the consumer must be scheduled, i.e., whether the queue
+     * was drained by the consumer before.
+     */
+    bool push(const key_type& uri, const value_t& value, sequence_type sequence = 0);
+
+    /**
+     * @brief Pop the oldest element from the queue.
+     *
+     * If the queue is empty the consumer is considered to be idle.
+     *
+     * @param element Receives the element.
+     * @return Whether an element was popped.
+     */
+    bool pop_front(update& element);
+
+    /**
+     * @brief Pop the oldest element from the queue.
+     *
+     * Like #pop_front(update&), but additionally reports the highest
+     * sequence number pushed so far when the queue turns out to be empty.
+     *
+     * @param element Receives the element.
+     * @param sequence Receives the sequence number covered by all popped
+     * elements, if no element was popped.
+     * @return Whether an element was popped.
+     */
+    bool pop_front(update& element, sequence_type& sequence);
+
+  private:
+    std::mutex       mutex_;
+    update_container updates_;
+    bool             scheduled_ = false;
+    sequence_type    sequence_  = 0;
+};
+
+} // namespace cli
+
+} // namespace decof
+
+#endif // DECOF_CLI_UPDATE_QUEUE_H
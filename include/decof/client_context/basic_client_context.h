@@ -17,9 +17,13 @@
 #ifndef DECOF_BASIC_CLIENT_CONTEXT_H
 #define DECOF_BASIC_CLIENT_CONTEXT_H
 
+#include <decof/heat_map.h>
 #include <decof/types.h>
 #include <decof/userlevel.h>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 namespace decof {
 
@@ -92,6 +96,20 @@ class basic_client_context
      */
     value_t get_parameter(const object* obj);
 
+    /**
+     * @brief Gets the value version of the given object if it is a readable
+     * parameter.
+     *
+     * The same access checks as with #get_parameter apply but the value is
+     * not read.
+     *
+     * @param obj Pointer to object or nullptr.
+     * @return The value version or zero if the parameter does not keep track
+     * of its value changes.
+     * @throws If obj does not point to a readable parameter.
+     */
+    std::uint64_t get_parameter_version(const object* obj);
+
     /**
      * @brief Signal event.
      *
@@ -114,6 +132,18 @@ class basic_client_context
      */
     void browse_object(object* obj, object_visitor* visitor);
 
+    /**
+     * @brief Returns the most accessed objects from the heat map.
+     *
+     * Objects that were destroyed meanwhile or that are not readable with the
+     * current userlevel are left out.
+     *
+     * @param count The maximum number of records.
+     * @param key Sort by number of accesses or by cumulative access time.
+     * @return The records in descending order.
+     */
+    std::vector<heat_map::record> heat_report(std::size_t count, heat_map::sort_key key);
+
     object_dictionary& object_dictionary_;
 
   private:
@@ -21,6 +21,7 @@
 #include <decof/client_observe_interface.h>
 #include <decof/userlevel.h>
 #include <boost/signals2/connection.hpp>
+#include <functional>
 #include <map>
 #include <string>
 
@@ -61,6 +62,40 @@ class client_context : public basic_client_context
      */
     void unobserve(object* obj);
 
+    /**
+     * @brief Invokes @a visitor for an observable parameter or for all
+     * observable parameters below a node.
+     *
+     * Descendants not readable with the effective userlevel are skipped.
+     *
+     * @param obj Pointer to the parameter or node.
+     * @param visitor Function invoked for each observable parameter.
+     */
+    void for_each_observable(object* obj, const std::function<void(object*)>& visitor);
+
+    /**
+     * @brief Observe a parameter or all observable parameters below a node.
+     *
+     * @param obj Pointer to the parameter or node.
+     * @param slot The slot to be called on updates of any of the parameters.
+     */
+    void observe_subtree(object* obj, const value_change_slot& slot);
+
+    /**
+     * @brief Terminate the observations of a parameter or of the parameters
+     * below a node.
+     *
+     * Parameters not observed are ignored.
+     */
+    void unobserve_subtree(object* obj);
+
+    /**
+     * @brief Terminate all parameter object observations.
+     *
+     * Observations of objects that no longer exist are dropped silently.
+     */
+    void unobserve_all();
+
     /// @brief Timer tick.
     /// Call this member function regularly in order to check for value changes
     /// of observed external_readonly_parameters.
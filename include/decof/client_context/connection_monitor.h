@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DECOF_CLIENT_CONTEXT_CONNECTION_MONITOR_H
+#define DECOF_CLIENT_CONTEXT_CONNECTION_MONITOR_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+namespace decof {
+
+/**
+ * @brief Keeps track of the live connections of a server.
+ *
+ * Besides counting connections the monitor can shut down connections which
+ * neither sent nor received data for some time. For this purpose it keeps a
+ * duplicate of the socket descriptor, so that a connection can be shut down
+ * from another strand than the one of its context without racing with the
+ * context closing its socket. Idle times are only known for TCP connections.
+ *
+ * All member functions are thread-safe.
+ */
+class connection_monitor
+{
+  public:
+    using id_type = std::uint64_t;
+
+    connection_monitor() = default;
+    connection_monitor(const connection_monitor&) = delete;
+    connection_monitor& operator=(const connection_monitor&) = delete;
+
+    ~connection_monitor();
+
+    /**
+     * @brief Add a connection.
+     *
+     * @param native_handle The socket descriptor of the connection.
+     * @param track_idle Whether the connection is subject to #reap().
+     * @return The id to remove the connection with.
+     */
+    id_type add(int native_handle, bool track_idle);
+
+    /// Removes a connection once its context is gone.
+    void remove(id_type id);
+
+    /// Returns the number of live connections.
+    std::size_t size() const;
+
+    /**
+     * @brief Shut down idle connections.
+     *
+     * Connections are shut down in both directions, so that their contexts
+     * see the end of the stream and close the connection as usual.
+     *
+     * @param timeout The minimum time without data sent or received.
+     * @return The number of connections shut down.
+     */
+    std::size_t reap(std::chrono::milliseconds timeout);
+
+  private:
+    mutable std::mutex mutex_;
+    id_type            next_id_ = 0;
+
+    /// Duplicated descriptors by connection id or -1 for untracked ones.
+    std::map<id_type, int> descriptors_;
+};
+
+} // namespace decof
+
+#endif // DECOF_CLIENT_CONTEXT_CONNECTION_MONITOR_H
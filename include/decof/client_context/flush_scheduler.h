@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DECOF_CLIENT_CONTEXT_FLUSH_SCHEDULER_H
+#define DECOF_CLIENT_CONTEXT_FLUSH_SCHEDULER_H
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/strand.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace decof {
+
+/**
+ * @brief Batches the flushes of publish/subscribe contexts.
+ *
+ * Publish/subscribe contexts schedule the write of their pending updates via
+ * this Boost.Asio service of their I/O service. With a non-zero interval all
+ * flushes scheduled within an interval are run together by a single timer
+ * expiry. Updates arriving in the meantime are coalesced into the same write,
+ * so that frequently changing parameters cost at most one write per
+ * connection and interval instead of one write per change.
+ *
+ * The interval defaults to zero, which flushes immediately.
+ *
+ * Example:
+ * @code
+ * boost::asio::use_service<decof::flush_scheduler>(io_service).interval(std::chrono::milliseconds(5));
+ * @endcode
+ */
+class flush_scheduler : public boost::asio::io_service::service
+{
+  public:
+    using strand_t = boost::asio::io_service::strand;
+
+    static boost::asio::io_service::id id;
+
+    explicit flush_scheduler(boost::asio::io_service& io_service);
+
+    /// Returns the flush interval.
+    std::chrono::microseconds interval() const;
+
+    /// Sets the flush interval, which takes effect for the next batch.
+    void interval(std::chrono::microseconds interval);
+
+    /**
+     * @brief Schedule a flush.
+     *
+     * Posts @a flush to @a strand either immediately or at the end of the
+     * current interval. May be called from any thread.
+     */
+    void schedule(strand_t& strand, std::function<void()> flush);
+
+    /// Returns the number of batches flushed after an interval.
+    std::size_t batches() const;
+
+  private:
+    void shutdown() override;
+
+    /// Runs the flushes scheduled during the expired interval.
+    void expired(const boost::system::error_code& error);
+
+    std::atomic<std::chrono::microseconds::rep> interval_{0};
+    std::atomic<std::size_t>                    batches_{0};
+
+    std::mutex                                               mutex_;
+    boost::asio::steady_timer                                timer_;
+    bool                                                     armed_ = false;
+    std::vector<std::pair<strand_t*, std::function<void()>>> pending_;
+};
+
+} // namespace decof
+
+#endif // DECOF_CLIENT_CONTEXT_FLUSH_SCHEDULER_H
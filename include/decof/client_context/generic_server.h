@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DECOF_GENERIC_SERVER_H
+#define DECOF_GENERIC_SERVER_H
+
+#include "client_context.h"
+#include "connection_monitor.h"
+#include "stream_socket.h"
+#include <decof/external_readonly_handler_parameter.h>
+#include <decof/object_dictionary.h>
+#include <decof/statistics.h>
+#include <decof/types.h>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/strand.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace decof {
+
+/**
+ * @brief Server accepting stream connections for a client context type.
+ *
+ * The server listens on an endpoint of the given stream protocol, e.g.,
+ * @c boost::asio::ip::tcp or @c boost::asio::local::stream_protocol, and
+ * hands accepted connections over to new instances of @a Context as
+ * @ref stream_socket.
+ *
+ * Unix domain endpoints in the Linux abstract namespace are given by a path
+ * starting with a null character. A socket file left over at a filesystem
+ * path by a server that is gone is replaced, and the socket file is removed
+ * when the server is destroyed.
+ *
+ * The number of concurrent connections can be limited, in which case further
+ * connections are closed right after accepting them. TCP connections can be
+ * shut down after an idle timeout. Errors accepting a connection, e.g., due to
+ * running out of file descriptors, are retried with exponential backoff.
+ *
+ * All member functions except for the constructor must be called from the
+ * object dictionary strand or before the I/O service is run.
+ */
+template <typename Context, typename Protocol = boost::asio::ip::tcp>
+class generic_server
+{
+  public:
+    using endpoint_type = typename Protocol::endpoint;
+
+    /// Note that the callback function takes ownership of the provided socket object.
+    generic_server(
+        object_dictionary&               obj_dict,
+        boost::asio::io_service::strand& strand,
+        const endpoint_type&             endpoint,
+        userlevel_t                      userlevel = Normal)
+      : object_dictionary_(obj_dict),
+        userlevel_(userlevel),
+        strand_(strand),
+        acceptor_(strand.context(), remove_stale_socket(strand.context(), endpoint)),
+        socket_(strand.context()),
+        backoff_timer_(strand.context()),
+        reap_timer_(strand.context()),
+        monitor_(std::make_shared<connection_monitor>())
+    {
+        if constexpr (std::is_same_v<Protocol, boost::asio::local::stream_protocol>) {
+            if (is_filesystem_path(endpoint))
+                socket_path_ = endpoint.path();
+        }
+    }
+
+    /// Removes the socket file of a Unix domain server, if any.
+    ~generic_server()
+    {
+        if (!socket_path_.empty()) {
+            boost::system::error_code ec;
+            acceptor_.close(ec);
+            ::unlink(socket_path_.c_str());
+        }
+    }
+
+    /// Returns the listening endpoint.
+    endpoint_type local_endpoint() const
+    {
+        return acceptor_.local_endpoint();
+    }
+
+    /// Returns the listening port.
+    /// This is identical to the port given in constructor if non-zero.
+    unsigned short port() const
+    {
+        return acceptor_.local_endpoint().port();
+    }
+
+    /// Returns the maximum number of concurrent connections or zero if unlimited.
+    std::size_t max_connections() const
+    {
+        return max_connections_;
+    }
+
+    /// Sets the maximum number of concurrent connections, zero for unlimited.
+    void max_connections(std::size_t max_connections)
+    {
+        max_connections_ = max_connections;
+    }
+
+    /// Returns the idle timeout or zero if disabled.
+    std::chrono::milliseconds idle_timeout() const
+    {
+        return idle_timeout_;
+    }
+
+    /**
+     * @brief Set the idle timeout.
+     *
+     * TCP connections which neither sent nor received data for the given time
+     * are shut down. The timeout applies to connections accepted afterwards
+     * and must be set before calling #preload(). Zero disables the timeout.
+     */
+    void idle_timeout(std::chrono::milliseconds timeout)
+    {
+        idle_timeout_ = timeout;
+    }
+
+    /// Returns the number of live connections.
+    std::size_t connections() const
+    {
+        return monitor_->size();
+    }
+
+    /// Returns the number of connections closed due to the connection limit.
+    std::size_t rejected_connections() const
+    {
+        return rejected_connections_;
+    }
+
+    /// Returns the number of connections shut down due to the idle timeout.
+    std::size_t reaped_connections() const
+    {
+        return reaped_connections_;
+    }
+
+    /**
+     * @brief Expose the connection counts as parameters.
+     *
+     * Creates the readonly parameters @c connections,
+     * @c rejected-connections and @c reaped-connections below @a parent.
+     * Subscribers are updated by the tick of the object dictionary.
+     */
+    void expose_connection_counts(node* parent)
+    {
+        connections_param_ = std::make_unique<count_parameter>("connections", parent);
+        connections_param_->external_value_handler([this]() { return static_cast<integer_t>(connections()); });
+
+        rejected_param_ = std::make_unique<count_parameter>("rejected-connections", parent);
+        rejected_param_->external_value_handler([this]() { return static_cast<integer_t>(rejected_connections_); });
+
+        reaped_param_ = std::make_unique<count_parameter>("reaped-connections", parent);
+        reaped_param_->external_value_handler([this]() { return static_cast<integer_t>(reaped_connections_); });
+    }
+
+    void preload()
+    {
+        if constexpr (std::is_same_v<Protocol, boost::asio::ip::tcp>)
+            acceptor_.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+        async_accept();
+
+        if (idle_timeout_.count() > 0)
+            schedule_reaping();
+    }
+
+    void async_accept()
+    {
+        acceptor_.async_accept(
+            socket_, strand_.wrap(std::bind(&generic_server::accept_handler, this, std::placeholders::_1)));
+    }
+
+  private:
+    using count_parameter = external_readonly_handler_parameter<integer_t>;
+
+    static constexpr std::chrono::milliseconds min_accept_backoff{10};
+    static constexpr std::chrono::milliseconds max_accept_backoff{1000};
+    static constexpr std::chrono::milliseconds min_reap_interval{10};
+
+    /// Returns whether a Unix domain endpoint refers to a filesystem path.
+    static bool is_filesystem_path(const endpoint_type& endpoint)
+    {
+        const auto path = endpoint.path();
+        return !path.empty() && path[0] != '\0';
+    }
+
+    /**
+     * @brief Removes a socket file nobody listens on anymore.
+     *
+     * Binding to an existing path fails, even if the server that created the
+     * socket file is gone. Other files and sockets still accepting
+     * connections are left alone, so that binding fails as usual.
+     */
+    static const endpoint_type& remove_stale_socket(boost::asio::io_service& io_service, const endpoint_type& endpoint)
+    {
+        if constexpr (std::is_same_v<Protocol, boost::asio::local::stream_protocol>) {
+            struct stat status;
+            const auto  path = endpoint.path();
+            if (is_filesystem_path(endpoint) && ::lstat(path.c_str(), &status) == 0 && S_ISSOCK(status.st_mode)) {
+                typename Protocol::socket probe(io_service);
+                boost::system::error_code ec;
+                probe.connect(endpoint, ec);
+                if (ec == boost::asio::error::connection_refused)
+                    ::unlink(path.c_str());
+            }
+        }
+
+        return endpoint;
+    }
+
+    void accept_handler(boost::system::error_code error)
+    {
+        // Check whether the server was stopped by a signal before this completion
+        // handler had a chance to run.
+        if (!acceptor_.is_open() || error == boost::asio::error::operation_aborted)
+            return;
+
+        if (error) {
+            // Accept errors are mostly temporary, e.g., when running out of
+            // file descriptors, so retry later instead of giving up
+            accept_backoff_ = std::clamp(accept_backoff_ * 2, min_accept_backoff, max_accept_backoff);
+            backoff_timer_.expires_after(accept_backoff_);
+            backoff_timer_.async_wait(strand_.wrap([this](boost::system::error_code error) {
+                if (!error)
+                    async_accept();
+            }));
+            return;
+        }
+
+        accept_backoff_ = std::chrono::milliseconds(0);
+
+        if (max_connections_ > 0 && monitor_->size() >= max_connections_) {
+            // Shed load by closing the connection right away
+            ++rejected_connections_;
+            boost::system::error_code ec;
+            socket_.close(ec);
+        } else {
+            // Create and preload new client context, which is delisted from
+            // the connection monitor when it is gone
+            const auto handle  = socket_.native_handle();
+            auto       context = std::make_unique<Context>(
+                strand_, stream_socket(std::move(socket_)), object_dictionary_, userlevel_);
+            const auto id = monitor_->add(handle, idle_timeout_.count() > 0);
+            statistics::add_connections(1);
+
+            std::shared_ptr<Context> shared_context(context.release(), [monitor = monitor_, id](Context* context) {
+                delete context;
+                monitor->remove(id);
+                statistics::add_connections(-1);
+            });
+            shared_context->preload();
+        }
+
+        async_accept();
+    }
+
+    void schedule_reaping()
+    {
+        reap_timer_.expires_after(std::max(idle_timeout_ / 4, min_reap_interval));
+        reap_timer_.async_wait(strand_.wrap([this](boost::system::error_code error) {
+            if (error)
+                return;
+
+            reaped_connections_ += monitor_->reap(idle_timeout_);
+            schedule_reaping();
+        }));
+    }
+
+    object_dictionary& object_dictionary_;
+    userlevel_t        userlevel_;
+
+    boost::asio::io_service::strand& strand_;
+    typename Protocol::acceptor      acceptor_;
+    typename Protocol::socket        socket_;
+    boost::asio::steady_timer        backoff_timer_;
+    boost::asio::steady_timer        reap_timer_;
+    std::chrono::milliseconds        accept_backoff_{0};
+    std::string                      socket_path_;
+
+    std::size_t                         max_connections_ = 0;
+    std::chrono::milliseconds           idle_timeout_{0};
+    std::size_t                         rejected_connections_ = 0;
+    std::size_t                         reaped_connections_   = 0;
+    std::shared_ptr<connection_monitor> monitor_;
+
+    std::unique_ptr<count_parameter> connections_param_;
+    std::unique_ptr<count_parameter> rejected_param_;
+    std::unique_ptr<count_parameter> reaped_param_;
+};
+
+/// Server accepting TCP connections.
+template <typename Context>
+using generic_tcp_server = generic_server<Context, boost::asio::ip::tcp>;
+
+/// Server accepting Unix domain stream connections.
+template <typename Context>
+using generic_local_server = generic_server<Context, boost::asio::local::stream_protocol>;
+
+} // namespace decof
+
+#endif // DECOF_GENERIC_SERVER_H
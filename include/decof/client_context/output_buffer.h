@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DECOF_CLIENT_CONTEXT_OUTPUT_BUFFER_H
+#define DECOF_CLIENT_CONTEXT_OUTPUT_BUFFER_H
+
+#include <boost/asio/buffer.hpp>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace decof {
+
+/**
+ * @brief Chain of buffers for scatter-gather socket output.
+ *
+ * Data can be appended by copying it into the buffer, by moving a string into
+ * the buffer or by referencing shared or static data. The latter variants do
+ * not copy any payload bytes. The buffer contents are handed to
+ * @c boost::asio::async_write as a sequence of buffers using @c data(), so
+ * the individual segments are sent with a single gather write.
+ *
+ * Segments already returned by @c data() are never modified or moved by later
+ * appends, which may therefore happen while a write operation is active.
+ */
+class output_buffer
+{
+  public:
+    using const_buffers_type = std::vector<boost::asio::const_buffer>;
+
+    output_buffer()                     = default;
+    output_buffer(const output_buffer&) = delete;
+    output_buffer& operator=(const output_buffer&) = delete;
+
+    /// Appends a copy of @a data.
+    void append(std::string_view data);
+
+    /// Appends @a data without copying its contents.
+    void append(std::string&& data);
+
+    /// Appends a reference to shared immutable data.
+    void append(std::shared_ptr<const std::string> data);
+
+    /// Appends a reference to data with static storage duration or to other
+    /// data that stays unmodified until it has been consumed.
+    void append_static(std::string_view data);
+
+    /// Returns the number of bytes not yet consumed.
+    std::size_t size() const;
+
+    bool empty() const;
+
+    /// Returns the buffer sequence representing the unconsumed contents.
+    const_buffers_type data();
+
+    /// Removes @a n bytes from the beginning of the buffer.
+    void consume(std::size_t n);
+
+    /// Returns the number of payload bytes copied into the buffer.
+    std::size_t bytes_copied() const;
+
+    /// Returns the number of payload bytes appended without copying.
+    std::size_t bytes_referenced() const;
+
+    void reset_counters();
+
+  private:
+    struct segment
+    {
+        std::string_view view() const;
+
+        std::string                        owned;
+        std::shared_ptr<const std::string> shared;
+        std::string_view                   referenced;
+        bool                               growable = false;
+    };
+
+    std::deque<segment> segments_;
+    std::size_t         offset_           = 0;
+    std::size_t         size_             = 0;
+    std::size_t         bytes_copied_     = 0;
+    std::size_t         bytes_referenced_ = 0;
+};
+
+/**
+ * @brief Stream buffer appending to an output_buffer.
+ *
+ * Allows to serialize into an output_buffer using @c std::ostream. Output is
+ * collected in a small local buffer and appended on @c flush() or
+ * destruction.
+ */
+class output_streambuf : public std::streambuf
+{
+  public:
+    explicit output_streambuf(output_buffer& buf);
+    ~output_streambuf() override;
+
+  protected:
+    int_type        overflow(int_type ch) override;
+    std::streamsize xsputn(const char_type* s, std::streamsize count) override;
+    int             sync() override;
+
+  private:
+    output_buffer& buf_;
+    char           local_[256];
+};
+
+} // namespace decof
+
+#endif // DECOF_CLIENT_CONTEXT_OUTPUT_BUFFER_H
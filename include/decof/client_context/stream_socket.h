@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DECOF_CLIENT_CONTEXT_STREAM_SOCKET_H
+#define DECOF_CLIENT_CONTEXT_STREAM_SOCKET_H
+
+#include <boost/asio/generic/stream_protocol.hpp>
+#include <string>
+
+namespace decof {
+
+/**
+ * @brief Socket type of connection oriented client contexts.
+ *
+ * A generic stream socket takes over sockets accepted by TCP as well as by
+ * Unix domain acceptors, so that client contexts do not depend on the
+ * transport they are served on.
+ */
+using stream_socket = boost::asio::generic::stream_protocol::socket;
+
+/// Returns the transport of a connected socket, i.e., "tcp" or "unix".
+std::string transport_name(const stream_socket& socket);
+
+/**
+ * @brief Returns a description of the peer of a connected socket.
+ *
+ * TCP peers are described by address and port. Unix domain peers are
+ * described by the credentials of the connecting process where available,
+ * e.g., "unix:pid=1234,uid=1000,gid=1000".
+ */
+std::string peer_name(const stream_socket& socket);
+
+} // namespace decof
+
+#endif // DECOF_CLIENT_CONTEXT_STREAM_SOCKET_H
@@ -18,9 +18,19 @@
 #define DECOF_CLIENT_READ_INTERFACE_H
 
 #include "types.h"
+#include <cstdint>
 
 namespace decof {
 
+/**
+ * @brief Returns a new value version.
+ *
+ * Value versions are unique within the process and increase monotonically.
+ * They start at the time of first use in microseconds since epoch, so that
+ * versions handed out by a previous server instance are not reused.
+ */
+std::uint64_t next_value_version() noexcept;
+
 /**
  * @brief Interface for client read access to parameter value.
  */
@@ -30,6 +40,19 @@ struct client_read_interface
 
     /// Provides the value as runtime-generic type.
     virtual value_t generic_value() const = 0;
+
+    /**
+     * @brief Returns the version of the current value.
+     *
+     * The version changes whenever the value changes, so clients can tell
+     * whether a value they have read before is still up to date without
+     * reading it again. A version of zero means that the parameter does not
+     * keep track of its value changes.
+     */
+    virtual std::uint64_t version() const noexcept
+    {
+        return 0;
+    }
 };
 
 } // namespace decof
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DECOF_COROUTINE_CLISRV_CONTEXT_H
+#define DECOF_COROUTINE_CLISRV_CONTEXT_H
+
+#include "context_base.h"
+#include <decof/cli/clisrv_context_base.h>
+#include <decof/client_context/output_buffer.h>
+#include <decof/client_context/stream_socket.h>
+#include <boost/asio/streambuf.hpp>
+#include <memory>
+#include <string>
+
+namespace decof {
+
+namespace coroutine {
+
+/**
+ * @brief CLI client/server context driven by a coroutine.
+ *
+ * Speaks the same protocol as @ref cli::clisrv_context. The connection is
+ * served by a single coroutine that alternates between writing the response,
+ * reading the next command line and evaluating it on the object dictionary
+ * strand. Receive and send buffers are kept for the lifetime of the
+ * connection.
+ */
+class clisrv_context : public cli::clisrv_context_base,
+                       public context_base,
+                       public std::enable_shared_from_this<clisrv_context>
+{
+  public:
+    using socket_t = stream_socket;
+
+    /** @brief Constructor.
+     *
+     * @param strand Reference to the Boost.Asio strand object that serializes
+     * accesses to the object dictionary. The coroutine runs on a strand of
+     * the context's own.
+     * @param socket Rvalue reference socket.
+     * @param od Reference to the object dictionary.
+     * @param userlevel The contexts default userlevel.
+     */
+    explicit clisrv_context(strand_t& strand, socket_t&& socket, object_dictionary& od, userlevel_t userlevel = Normal);
+
+    virtual std::string connection_type() const final;
+    virtual std::string remote_endpoint() const final;
+    virtual void        preload() final;
+
+  private:
+    /// Serves the connection until the peer disconnects.
+    awaitable<void> run();
+
+    socket_t               socket_;
+    std::string            remote_endpoint_;
+    std::string            connection_type_;
+    boost::asio::streambuf inbuf_;
+    std::string            request_;
+    output_buffer          outbuf_;
+};
+
+} // namespace coroutine
+
+} // namespace decof
+
+#endif // DECOF_COROUTINE_CLISRV_CONTEXT_H
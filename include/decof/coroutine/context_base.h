@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DECOF_COROUTINE_CONTEXT_BASE_H
+#define DECOF_COROUTINE_CONTEXT_BASE_H
+
+// Must precede <boost/asio/awaitable.hpp> which uses std::exchange but does not
+// include <utility> in some Boost versions
+#include <utility>
+
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/awaitable.hpp>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <exception>
+#include <type_traits>
+
+namespace decof {
+
+namespace coroutine {
+
+/**
+ * @brief Base class for coroutine based client contexts.
+ *
+ * Derived contexts implement their connection logic as a C++20 coroutine
+ * that is spawned on the strand #strand_ of the context's own. Socket
+ * operations are awaited using #use_awaitable and object dictionary accesses
+ * using #on_dictionary_strand().
+ *
+ * Boost.Asio allocates coroutine frames and completion handlers from a
+ * per-thread recycling allocator, so that awaiting an operation does not
+ * allocate memory in the steady state.
+ */
+class context_base
+{
+  public:
+    using strand_t      = boost::asio::io_service::strand;
+    using executor_type = strand_t;
+
+    /// Coroutines run on a legacy strand rather than a type-erased executor,
+    /// which would allocate when scheduling each resumption.
+    template <typename T>
+    using awaitable = boost::asio::awaitable<T, executor_type>;
+
+    /// Completion token for awaiting operations in coroutines of this context.
+    static constexpr boost::asio::use_awaitable_t<executor_type> use_awaitable{};
+
+  protected:
+    /** @brief Constructor.
+     *
+     * @param strand Reference to the Boost.Asio strand object that serializes
+     * accesses to the object dictionary.
+     */
+    explicit context_base(strand_t& strand)
+      : dictionary_strand_(strand), strand_(strand.context())
+    {
+    }
+
+    /** @brief Invoke a callable on the object dictionary strand.
+     *
+     * The awaiting coroutine is resumed on its own executor afterwards. The
+     * result of @a f is returned and an exception thrown by @a f is rethrown
+     * in the coroutine. A non-void result type must be default constructible.
+     *
+     * Data members of the context may be accessed by @a f without further
+     * synchronization as the coroutine is suspended in the meantime.
+     */
+    template <typename F>
+    auto on_dictionary_strand(F f)
+    {
+        using result_type = std::invoke_result_t<F&>;
+
+        if constexpr (std::is_void_v<result_type>) {
+            return boost::asio::async_initiate<const boost::asio::use_awaitable_t<executor_type>,
+                                               void(std::exception_ptr)>(
+                [this](auto handler, F f) {
+                    boost::asio::post(dictionary_strand_, [handler = std::move(handler), f = std::move(f)]() mutable {
+                        std::exception_ptr ex;
+                        try {
+                            f();
+                        } catch (...) {
+                            ex = std::current_exception();
+                        }
+
+                        auto executor = boost::asio::get_associated_executor(handler);
+                        boost::asio::post(executor, [handler = std::move(handler), ex]() mutable { handler(ex); });
+                    });
+                },
+                use_awaitable,
+                std::move(f));
+        } else {
+            return boost::asio::async_initiate<const boost::asio::use_awaitable_t<executor_type>,
+                                               void(std::exception_ptr, result_type)>(
+                [this](auto handler, F f) {
+                    boost::asio::post(dictionary_strand_, [handler = std::move(handler), f = std::move(f)]() mutable {
+                        std::exception_ptr ex;
+                        result_type        result{};
+                        try {
+                            result = f();
+                        } catch (...) {
+                            ex = std::current_exception();
+                        }
+
+                        auto executor = boost::asio::get_associated_executor(handler);
+                        boost::asio::post(executor,
+                                          [handler = std::move(handler), ex, result = std::move(result)]() mutable {
+                                              handler(ex, std::move(result));
+                                          });
+                    });
+                },
+                use_awaitable,
+                std::move(f));
+        }
+    }
+
+    strand_t&     dictionary_strand_;
+    executor_type strand_;
+};
+
+} // namespace coroutine
+
+} // namespace decof
+
+#endif // DECOF_COROUTINE_CONTEXT_BASE_H
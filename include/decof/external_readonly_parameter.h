@@ -64,6 +64,12 @@ class external_readonly_parameter : public tick_interface, public observable_par
         return external_value();
     }
 
+    /// External values may change without notice, so no version is kept.
+    virtual std::uint64_t version() const noexcept override final
+    {
+        return 0;
+    }
+
     /// @brief Call this member function to signal value changes.
     /// In cases where a value change information is obtained by external means,
     /// (e.g., from a select() on a file descriptor) calling this member
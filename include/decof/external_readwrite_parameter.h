@@ -69,6 +69,12 @@ class external_readwrite_parameter : public observable_parameter<T, EncodingHint
         return external_value();
     }
 
+    /// External values may change without notice, so no version is kept.
+    virtual std::uint64_t version() const noexcept override final
+    {
+        return 0;
+    }
+
   private:
     virtual void value(const T& value) override final
     {
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DECOF_HEAT_MAP_H
+#define DECOF_HEAT_MAP_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace decof {
+
+class object;
+
+/**
+ * @brief Per-object access counters.
+ *
+ * The heat map counts how often client contexts read, write and observe
+ * objects and how often parameters emit value changes. Reads and writes also
+ * accumulate the time spent in the parameter, e.g., in external_value(), so
+ * that slow parameters can be spotted.
+ *
+ * The counters are kept in a table indexed by object rather than in the
+ * objects themselves, so that they do not cost anything if the heat map is
+ * disabled, which is the default. The heat map must only be used from the
+ * object dictionary strand.
+ */
+class heat_map
+{
+  public:
+    using duration = std::chrono::steady_clock::duration;
+
+    enum class access { read, write, observe, emit };
+
+    enum class sort_key { count, time };
+
+    struct counters
+    {
+        std::uint64_t reads      = 0;
+        std::uint64_t writes     = 0;
+        std::uint64_t observes   = 0;
+        std::uint64_t emits      = 0;
+        duration      read_time  = duration::zero();
+        duration      write_time = duration::zero();
+
+        /// Returns the number of all accesses.
+        std::uint64_t count() const noexcept;
+
+        /// Returns the cumulative time of all reads and writes.
+        duration time() const noexcept;
+    };
+
+    struct record
+    {
+        /// The object as counted, which may have been destroyed since.
+        const object* obj;
+
+        /// The fully qualified name of the object when first counted.
+        std::string uri;
+
+        counters values;
+    };
+
+    /// Returns whether accesses are counted.
+    bool enabled() const noexcept;
+
+    /// Enable or disable counting. Disabling keeps the counters.
+    void enabled(bool enabled) noexcept;
+
+    /**
+     * @brief Count an access of an object.
+     *
+     * Does nothing if the heat map is disabled.
+     *
+     * @param obj The accessed object.
+     * @param type The access type.
+     * @param time The time spent in the access, only used for reads and
+     * writes.
+     */
+    void count(const object* obj, access type, duration time = duration::zero());
+
+    /// Returns the records of all counted objects in descending order.
+    std::vector<record> sorted(sort_key key) const;
+
+    /// Resets all counters.
+    void clear();
+
+  private:
+    struct entry
+    {
+        std::string uri;
+        counters    values;
+    };
+
+    bool                                     enabled_ = false;
+    std::unordered_map<const object*, entry> entries_;
+};
+
+} // namespace decof
+
+#endif // DECOF_HEAT_MAP_H
@@ -19,6 +19,8 @@
 
 #include "readable_parameter.h"
 #include "types.h"
+#include <atomic>
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <string_view>
@@ -82,6 +84,15 @@ class node : public readable_parameter<std::list<const char*>>
     /// Returns an iterator for the list of children.
     iterator end();
 
+    /**
+     * @brief Returns the tree structure generation.
+     *
+     * The generation is incremented whenever a child is added to or removed
+     * from any node. Clients can use it to invalidate cached descriptions of
+     * the object tree.
+     */
+    static std::uint64_t generation() noexcept;
+
   private:
     /**
      * @brief Finds first child object with given name.
@@ -94,6 +105,8 @@ class node : public readable_parameter<std::list<const char*>>
     // We use std::list because iterators of a list remain valid when elements
     // are deleted.
     children_t children_;
+
+    static std::atomic<std::uint64_t> generation_;
 };
 
 } // namespace decof
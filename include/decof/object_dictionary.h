@@ -17,7 +17,10 @@
 #ifndef DECOF_OBJECT_DICTIONARY_H
 #define DECOF_OBJECT_DICTIONARY_H
 
+#include "change_journal.h"
+#include "heat_map.h"
 #include "node.h"
+#include <cstddef>
 #include <list>
 #include <string_view>
 
@@ -71,6 +74,9 @@ class object_dictionary : public node
      */
     void unregister_for_tick(tick_interface* tick_target);
 
+    /// Returns the number of registered tick targets.
+    std::size_t tick_target_count() const;
+
     /**
      * @brief Find object with given URI.
      *
@@ -85,6 +91,28 @@ class object_dictionary : public node
      */
     object* find_object(std::string_view uri, char separator = ':');
 
+    /**
+     * @brief Access the change journal.
+     *
+     * The journal is disabled by default. Enable it by setting a non-zero
+     * capacity, e.g., @code journal().capacity(4096) @endcode.
+     */
+    change_journal& journal();
+
+    /// @copydoc journal()
+    const change_journal& journal() const;
+
+    /**
+     * @brief Access the per-object access counters.
+     *
+     * The heat map is disabled by default. Enable it by calling
+     * @code heat().enabled(true) @endcode.
+     */
+    heat_map& heat();
+
+    /// @copydoc heat()
+    const heat_map& heat() const;
+
   private:
     void set_current_context(basic_client_context* client_context);
 
@@ -92,6 +120,8 @@ class object_dictionary : public node
 
     basic_client_context*      current_context_{nullptr};
     std::list<tick_interface*> tick_targets_;
+    change_journal             journal_;
+    heat_map                   heat_;
 };
 
 } // namespace decof
@@ -21,6 +21,7 @@
 #include "client_observe_interface.h"
 #include "conversion.h"
 #include "encoding_hint.h"
+#include "object_dictionary.h"
 #include "object_visitor.h"
 #include "typed_client_read_interface.h"
 #include <boost/signals2/connection.hpp>
@@ -36,7 +37,9 @@ class observable_parameter : public basic_parameter<T, EncodingHint>,
     virtual boost::signals2::scoped_connection observe(value_change_slot slot) override
     {
         boost::signals2::scoped_connection retval = signal_.connect(slot);
-        emit(this->value());
+
+        // The initial value is not a change and thus not journaled
+        signal_(this->fq_name(), conversion_helper<T, EncodingHint>::to_generic(this->value()));
         return retval;
     }
 
@@ -49,20 +52,40 @@ class observable_parameter : public basic_parameter<T, EncodingHint>,
     {
     }
 
+    /// Returns the value version which changes with each emitted change.
+    virtual std::uint64_t version() const noexcept override
+    {
+        return version_;
+    }
+
   protected:
     // We inherit base class constructors
     using basic_parameter<T, EncodingHint>::basic_parameter;
 
     /** @brief Emit parameter value observation signal.
+     *
+     * The change is also recorded in the object dictionary's change journal
+     * and heat map and a new value version is assigned.
      *
      * @param value The value to be reported to the connected slot(s).
      */
     void emit(const T& value)
     {
-        signal_(this->fq_name(), conversion_helper<T, EncodingHint>::to_generic(value));
+        const auto uri = this->fq_name();
+
+        version_ = next_value_version();
+        if (auto od = this->get_object_dictionary()) {
+            od->journal().record(uri);
+            od->heat().count(this, heat_map::access::emit);
+        }
+
+        signal_(uri, conversion_helper<T, EncodingHint>::to_generic(value));
     }
 
     value_change_signal signal_;
+
+  private:
+    std::uint64_t version_ = next_value_version();
 };
 
 } // namespace decof
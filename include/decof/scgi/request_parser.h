@@ -17,63 +17,113 @@
 #ifndef DECOF_SCGI_PARSER_H
 #define DECOF_SCGI_PARSER_H
 
-#include <map>
+#include <cstddef>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace decof {
 
 namespace scgi {
 
+/**
+ * @brief List of SCGI request headers.
+ *
+ * Names and values are views into the buffer of the request_parser and are
+ * valid until the parser is reset.
+ */
+class header_list
+{
+  public:
+    using value_type     = std::pair<std::string_view, std::string_view>;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    /// Returns the value of the given header.
+    /// @throw std::out_of_range if there is no such header.
+    std::string_view at(std::string_view name) const;
+
+    /// Returns a pointer to the value of the given header or @c nullptr.
+    const std::string_view* find(std::string_view name) const;
+
+    std::size_t count(std::string_view name) const;
+    std::size_t size() const;
+    bool        empty() const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    void clear();
+    void emplace_back(std::string_view name, std::string_view value);
+
+  private:
+    std::vector<value_type> headers_;
+};
+
 class request_parser
 {
   public:
-    typedef std::map<std::string, std::string> headers_type;
+    typedef header_list headers_type;
 
     enum method_type { get, post, head, put, delete_, trace, options, connect, undefined };
 
     /// Result of parse.
-    enum result_type { good, bad, indeterminate };
+    enum result_type { good, bad, indeterminate, too_large };
 
     request_parser();
 
+    // Headers refer to internal storage, so don't copy
+    request_parser(const request_parser&) = delete;
+    request_parser& operator=(const request_parser&) = delete;
+
     /// Reset to initial parser state.
     void reset();
 
-    /// @brief Start parsing procedure.
+    /// @brief Parse the given chunk of input.
+    ///
+    /// Can be called repeatedly with consecutive chunks of a request.
     ///
     /// @returns #good when a complete request has been parsed, #bad if the
-    /// data is invalid, #indeterminate when more data is required.
-    template <typename InputIterator>
-    result_type parse(InputIterator begin, InputIterator end) noexcept
-    {
-        result_type result;
-        while (begin != end) {
-            result = consume(*begin++);
-            if (result == bad)
-                return bad;
-        }
-        return result;
-    }
-
-    method_type  method;
-    std::string  uri;
-    headers_type headers;
-    std::string  content_type;
-    std::string  encoding;
-    std::string  body;
+    /// data is invalid, #indeterminate when more data is required, and
+    /// #too_large if the announced headers exceed 64 KiB or the announced
+    /// body exceeds the maximum body size.
+    result_type parse(const char* begin, const char* end) noexcept;
+
+    /// Set the maximum accepted body size in bytes.
+    void max_body_size(std::size_t size) noexcept;
+
+    /**
+     * @brief Returns the storage for the body part not yet received.
+     *
+     * The storage is sized from @c CONTENT_LENGTH once the headers have been
+     * parsed, so that the remaining body can be received straight into it.
+     * Call #body_received afterwards.
+     */
+    std::pair<char*, std::size_t> pending_body() noexcept;
+
+    /// Notifies that @a n bytes have been written to the storage returned by
+    /// #pending_body.
+    result_type body_received(std::size_t n) noexcept;
+
+    method_type      method;
+    std::string_view uri;
+    headers_type     headers;
+    std::string_view content_type;
+    std::string_view encoding;
+    std::string      body;
 
   private:
-    /// Handle the next character of input.
-    result_type consume(char input) noexcept;
+    /// Parses the complete header netstring in #header_buf_.
+    result_type parse_headers();
 
-    enum state { netstring_length, header_start, header_name, header_value, body_range } state_;
+    enum state { netstring_length, header_range, header_end, body_range, done } state_;
 
-    std::string netstring_length_str_;
-    size_t      netstring_length_;
-    size_t      netstring_count_;
-    std::string current_header_;
-    std::string current_value_;
-    size_t      content_length_;
+    std::string header_buf_;
+    std::size_t netstring_length_;
+    std::size_t content_length_;
+    std::size_t body_size_;
+    std::size_t max_body_size_;
 };
 
 } // namespace scgi
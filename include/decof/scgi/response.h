@@ -17,14 +17,55 @@
 #ifndef DECOF_SCGI_RESPONSE_H
 #define DECOF_SCGI_RESPONSE_H
 
-#include <map>
+#include <decof/client_context/output_buffer.h>
+#include <cstddef>
+#include <memory>
 #include <ostream>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 namespace decof {
 
 namespace scgi {
 
+/**
+ * @brief List of HTTP response headers.
+ *
+ * Responses carry a handful of headers, so they are kept in insertion order
+ * in a flat list and looked up linearly. The interface is the part of
+ * @c std::map used for response headers.
+ */
+class response_headers
+{
+  public:
+    using value_type     = std::pair<std::string, std::string>;
+    using iterator       = std::vector<value_type>::iterator;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    /// Returns the value of the given header, which is appended if missing.
+    std::string& operator[](std::string_view name);
+
+    /// Returns the given header or #end.
+    iterator       find(std::string_view name);
+    const_iterator find(std::string_view name) const;
+
+    std::size_t count(std::string_view name) const;
+    std::size_t size() const;
+    bool        empty() const;
+
+    iterator       begin();
+    iterator       end();
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    void clear();
+
+  private:
+    std::vector<value_type> headers_;
+};
+
 struct response
 {
     enum class status_code {
@@ -47,6 +88,7 @@ struct response
         not_acceptable        = 406,
         request_timeout       = 408,
         precondition_failed   = 412,
+        payload_too_large     = 413,
         unsatisfiable_range   = 416,
         internal_server_error = 500,
         not_implemented       = 501,
@@ -58,9 +100,62 @@ struct response
     std::string     status_text() const;
     static response stock_response(status_code status);
 
-    status_code                        status;
-    std::map<std::string, std::string> headers;
-    std::string                        body;
+    /// Returns whether the status permits a message body.
+    bool has_body() const;
+
+    /// Returns status line and headers including the terminating empty line.
+    std::string header() const;
+
+    /// Appends status line and headers including the terminating empty line
+    /// to @a out.
+    void write_header(std::string& out) const;
+
+    /// Returns whether the response has neither headers nor a body.
+    bool is_stock() const;
+
+    /**
+     * @brief Returns the preformatted stock response of the given status.
+     *
+     * The bytes are formatted once and have static storage duration.
+     *
+     * @throw std::out_of_range if the status is unknown.
+     */
+    static std::string_view stock_bytes(status_code status);
+
+    /**
+     * @brief Serializes the response into an output buffer.
+     *
+     * Stock responses are referenced from static storage. The body is moved
+     * into the buffer without copying it and is empty afterwards. A shared
+     * body is referenced by the buffer.
+     */
+    void serialize(output_buffer& buf);
+
+    /**
+     * @brief Serializes the response using a reusable header buffer.
+     *
+     * The same as serialize(output_buffer&) but the header is written into
+     * @a header_buf, which is referenced by @a buf and must neither be
+     * modified nor destroyed until @a buf has been consumed.
+     */
+    void serialize(output_buffer& buf, std::string& header_buf);
+
+    /// Returns the message body, i.e., the shared body if set.
+    const std::string& content() const;
+
+    status_code      status;
+    response_headers headers;
+    std::string      body;
+
+    /// Immutable body shared with a cache, used instead of @c body if set.
+    std::shared_ptr<const std::string> shared_body;
+
+    /// Omit the Content-Length header for a body that is streamed until the
+    /// connection is closed.
+    bool unbounded_body = false;
+
+  private:
+    void serialize_body(output_buffer& buf);
 };
 
 } // namespace scgi
@@ -71,21 +166,9 @@ struct response
 template <class Traits>
 std::basic_ostream<char, Traits>& operator<<(std::basic_ostream<char, Traits>& os, const decof::scgi::response& resp)
 {
-    using decof::scgi::response;
-    std::string str = resp.status_text();
-    os << "HTTP/1.1 " << static_cast<size_t>(resp.status) << " " << resp.status_text() << "\r\n";
-    for (const auto& header : resp.headers)
-        os << header.first << ": " << header.second << "\r\n";
-    if (resp.headers.count("Content-Type") == 0)
-        os << "Content-Type: text/plain\r\n";
-
-    if (!((resp.status >= response::status_code::continue_ && resp.status < response::status_code::ok) ||
-          resp.status == response::status_code::no_content || resp.status == response::status_code::not_modified)) {
-        // No body allowed in other stati
-        // (see http://www.w3.org/Protocols/rfc2616/rfc2616-sec4.html#sec4.4)
-        os << "Content-Length: " << resp.body.size() << "\r\n\r\n" << resp.body;
-    } else
-        os << "\r\n";
+    os << resp.header();
+    if (resp.has_body())
+        os << resp.content();
 
     os << std::flush;
     return os;
@@ -19,14 +19,20 @@
 
 #include "request_parser.h"
 #include "response.h"
+#include <decof/cli/update_queue.h>
 #include <decof/client_context/client_context.h>
+#include <decof/client_context/flush_scheduler.h>
+#include <decof/client_context/output_buffer.h>
+#include <decof/client_context/stream_socket.h>
 #include <boost/asio/io_service.hpp>
-#include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/strand.hpp>
-#include <boost/asio/streambuf.hpp>
-#include <array>
+#include <chrono>
+#include <exception>
 #include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace decof {
 
@@ -36,12 +42,13 @@ class scgi_context final : public client_context, public std::enable_shared_from
 {
   public:
     using strand_t = boost::asio::io_service::strand;
-    using socket_t = boost::asio::ip::tcp::socket;
+    using socket_t = stream_socket;
 
     /** @brief Constructor.
      *
-     * @param strand Reference to a Boost.Asio strand object used to dispatch
-     * the handlers.
+     * @param strand Reference to the Boost.Asio strand object that serializes
+     * accesses to the object dictionary. Socket I/O, parsing and encoding run
+     * on a strand of the context's own.
      * @param socket Rvalue reference socket.
      * @param od Reference to the object dictionary.
      * @param userlevel The contexts default userlevel.
@@ -53,16 +60,80 @@ class scgi_context final : public client_context, public std::enable_shared_from
 
     void preload();
 
+    /** @brief Set the maximum request body size.
+     *
+     * Requests announcing a larger body are rejected with status 413 before
+     * the body is received. The default is 16 MiB.
+     *
+     * @param size The maximum body size in bytes. */
+    static void max_body_size(std::size_t size) noexcept;
+
   private:
     /** @brief Callback for boost::asio read operations.
      *
      * Parses and evaluates SCGI requests. */
     void read_handler(const boost::system::error_code& error, std::size_t bytes_transferred);
 
+    /// Callback for boost::asio read operations of the request body.
+    void body_handler(const boost::system::error_code& error, std::size_t bytes_transferred);
+
+    /// Evaluates the parser result of received data.
+    void process_result(request_parser::result_type result);
+
+    /// Sends the error response matching the given exception.
+    void handle_exception(std::exception_ptr ex);
+
+    /**
+     * @brief Accesses the object dictionary from the connection strand.
+     *
+     * Invokes @a access on the object dictionary strand and @a complete with
+     * its result on the connection strand. Exceptions thrown by either of
+     * them are answered with the matching error response.
+     */
+    template <typename Access, typename Complete>
+    void access_dictionary(Access access, Complete complete);
+
     /// Handle HTTP GET request.
     /// A GET request is used to read readable parameters.
     void handle_get_request();
 
+    /// Sends the given parameter value in the representation @a selected by
+    /// negotiating the request's Accept header.
+    void send_value_response(response resp, const value_t& value, std::size_t selected);
+
+    /// Handle batch read request of the given parameter URIs.
+    /// Items are read in one pass and returned as multipart document.
+    void handle_batch_request(const std::vector<std::string>& uris);
+
+    /**
+     * @brief Handle event stream request of the given parameter URIs.
+     *
+     * Starts a Server-Sent Events stream of the values of the given
+     * parameters and of the parameters below the given nodes. The stream
+     * lasts until the connection is closed. */
+    void handle_event_stream_request(const std::vector<std::string>& uris);
+
+    /// Handle heat map report request with the given query string.
+    /// The most accessed objects are returned as JSON array.
+    void handle_heat_request(std::string_view query);
+
+    /// Callback for parameter value changes of event streams.
+    void notify(const std::string& uri, const value_t& value);
+
+    /// Writes pending updates of an event stream if possible.
+    void preload_writing();
+
+    /// Reads from an event stream connection in order to detect closing.
+    void await_close();
+
+    /// Handle HTTP GET request to the object tree description.
+    /// The description is cached and supports conditional requests.
+    void handle_browse_request();
+
+    /// Handle the HTTP Range header of a GET request of the given value.
+    /// Returns whether a partial or error response has been sent.
+    bool handle_range_request(response& resp, const value_t& value);
+
     /// Handle HTTP PUT request.
     /// A PUT request is used to modify readwrite parameters. According to the
     /// HTTP/1.1 specification (RFC2616, clause §9.2.1), PUT requests shall be
@@ -76,20 +147,45 @@ class scgi_context final : public client_context, public std::enable_shared_from
     void handle_post_request();
 
     /// Sends the given reply to the client.
-    void send_response(const response& resp);
+    void send_response(response resp);
+
+    /// Records the latency of the request currently served, if any.
+    void record_latency();
 
     /// Callback for boost::asio write operations.
-    void write_handler(const boost::system::error_code& error, std::size_t);
+    void write_handler(const boost::system::error_code& error, std::size_t bytes_transferred);
 
     /// Closes the socket and delists client context from object dictionary.
     void disconnect();
 
-    strand_t& strand_;
-    socket_t  socket_;
+    strand_t&        dictionary_strand_;
+    strand_t         strand_;
+    flush_scheduler& flush_scheduler_;
+    socket_t         socket_;
+
+    static const size_t inbuf_size_ = 4096;
+    std::vector<char>   inbuf_;
+    output_buffer       outbuf_;
+
+    /// Response header storage reused for each response.
+    std::string header_buf_;
+
+    /// Event storage reused for each event of an event stream.
+    std::string event_buf_;
+
+    /// Close the connection once the response is sent.
+    bool disconnect_after_write_ = false;
+
+    /// Reception time of the request currently served.
+    std::optional<std::chrono::steady_clock::time_point> request_received_;
+
+    static std::size_t max_body_size_;
 
-    static const size_t           inbuf_size_ = 1500;
-    std::array<char, inbuf_size_> inbuf_;
-    boost::asio::streambuf        outbuf_;
+    /// Event stream state.
+    bool              streaming_      = false;
+    bool              writing_active_ = false;
+    std::size_t       socket_send_buf_size_;
+    cli::update_queue pending_updates_;
 
     /// The remote endpoint (HTTP client) as taken from the SCGI request.
     std::string remote_endpoint_;
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DECOF_SHM_PUBLISHER_H
+#define DECOF_SHM_PUBLISHER_H
+
+#include "ring.h"
+#include <decof/client_context/client_context.h>
+#include <decof/types.h>
+#include <decof/userlevel.h>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/strand.hpp>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace decof {
+
+namespace shm {
+
+/**
+ * @brief Publisher of parameter changes to same-host subscribers.
+ *
+ * The publisher writes the changes of the published parameters to a
+ * lock-free single-producer/multi-consumer ring in shared memory (see
+ * ring.h). Records are written directly from the observation signal, i.e.,
+ * from within the emitting parameter's @c emit call.
+ *
+ * Subscribers attach by connecting to a Unix domain socket, on which they
+ * receive the shared memory and an eventfd for wakeups (see
+ * shm::subscriber). Attaching subscribers receive the current values of all
+ * published parameters on that socket, too, so that other subscribers do
+ * not see them. At most @ref max_consumers subscribers can be attached;
+ * further connections are closed right away.
+ *
+ * All member functions and value changes of published parameters must be
+ * invoked on the given strand.
+ */
+class publisher : public client_context
+{
+  public:
+    using strand_t      = boost::asio::io_service::strand;
+    using endpoint_type = boost::asio::local::stream_protocol::endpoint;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param od Reference to the object dictionary.
+     * @param strand Reference to the Boost.Asio strand object that serializes
+     * accesses to the object dictionary.
+     * @param endpoint The Unix domain endpoint subscribers connect to.
+     * @param capacity Size of the ring's data area; rounded up to a power
+     * of two.
+     * @param userlevel The publisher's userlevel.
+     */
+    publisher(
+        object_dictionary&   od,
+        strand_t&            strand,
+        const endpoint_type& endpoint,
+        std::size_t          capacity  = 1 << 20,
+        userlevel_t          userlevel = Normal);
+    ~publisher();
+
+    std::string connection_type() const final;
+
+    /// Starts accepting subscribers.
+    void preload();
+
+    /**
+     * @brief Publishes the changes of a parameter or of all observable
+     * parameters below a node.
+     *
+     * @param uri Fully qualified name of the parameter or node.
+     * @throw invalid_parameter_error if the object does not exist.
+     */
+    void publish(const std::string& uri);
+
+    /// Stops publishing the changes of a parameter or node.
+    void unpublish(const std::string& uri);
+
+    /// Returns the number of records dropped because they exceed a quarter of
+    /// the ring capacity.
+    std::uint64_t dropped() const noexcept;
+
+  private:
+    /// Connection of an attached subscriber.
+    struct connection
+    {
+        std::unique_ptr<boost::asio::local::stream_protocol::socket> socket;
+        int                                                          eventfd = -1;
+        char                                                         dummy;
+    };
+
+    void async_accept();
+    void accept_handler(const boost::system::error_code& error);
+
+    /// Sends the handshake to a new subscriber and assigns a consumer slot.
+    /// The socket is closed if the subscriber cannot be attached.
+    void attach(boost::asio::local::stream_protocol::socket socket);
+
+    /// Releases the consumer slot of a disconnected subscriber.
+    void detach(std::size_t slot);
+
+    void notify(const std::string& uri, const value_t& value);
+
+    /// Encodes @a value into the value buffer and returns the record size.
+    std::size_t encode_record(const std::string& uri, const value_t& value);
+
+    /// Appends a record to the ring and wakes waiting subscribers.
+    void write_record(const std::string& uri, const value_t& value);
+
+    /// Returns the records of the current values of all published parameters.
+    std::string snapshot();
+
+    strand_t&                                     strand_;
+    boost::asio::local::stream_protocol::acceptor acceptor_;
+    boost::asio::local::stream_protocol::socket   socket_;
+
+    int             memfd_           = -1;
+    int             consumers_memfd_ = -1;
+    std::size_t     mapping_size_;
+    ring_header*    header_;
+    consumer_table* consumers_;
+    char*           data_;
+
+    std::uint64_t sequence_ = 0;
+    std::uint64_t dropped_  = 0;
+    std::string   value_buf_;
+
+    std::vector<std::string>              published_uris_;
+    std::array<connection, max_consumers> connections_;
+};
+
+} // namespace shm
+
+} // namespace decof
+
+#endif // DECOF_SHM_PUBLISHER_H
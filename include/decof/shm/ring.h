@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DECOF_SHM_RING_H
+#define DECOF_SHM_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace decof {
+
+namespace shm {
+
+/**
+ * @brief Layout of the shared-memory update ring.
+ *
+ * The ring consists of a @ref ring_header followed by the data area. The
+ * single producer appends records at the absolute byte position @c head;
+ * the position of a record in the data area is its absolute position modulo
+ * the capacity. Each consumer keeps its own read position, so consumers
+ * never block the producer nor each other.
+ *
+ * Before writing a record the producer advances @c reserve to the end of
+ * the record. A consumer that copied a record starting at position @c p
+ * validates the copy by checking that @c reserve did not pass
+ * <tt>p + capacity</tt> meanwhile. Otherwise the record was overwritten
+ * and the consumer resynchronizes at @c head.
+ *
+ * Records that would wrap around the end of the data area are preceded by a
+ * padding record, or by an implicit padding if the space left is smaller
+ * than a record header.
+ *
+ * Consumers map the ring read-only. The only state they write, the
+ * per-consumer @ref consumer_slot, lives in a separate @ref consumer_table
+ * shared memory.
+ */
+
+/// Magic number identifying an update ring ("DCF2RING").
+const std::uint64_t ring_magic = 0x474e495232464344;
+
+/// Version of the ring layout.
+const std::uint32_t ring_version = 2;
+
+/// Maximum number of concurrently attached consumers.
+const std::size_t max_consumers = 32;
+
+/// Alignment of records in the data area.
+const std::size_t record_alignment = 8;
+
+/// Marker of padding records in @ref record_header::uri_size.
+const std::uint32_t padding_record = 0xffffffff;
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Lock-free 64 bit atomics required");
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "Lock-free 32 bit atomics required");
+
+/// Per-consumer state shared with the producer.
+struct alignas(64) consumer_slot
+{
+    /// Whether the slot is assigned to a consumer.
+    std::atomic<std::uint32_t> in_use;
+
+    /// Whether the consumer waits to be woken via its eventfd.
+    std::atomic<std::uint32_t> waiting;
+};
+
+struct ring_header
+{
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t reserved;
+
+    /// Size of the data area in bytes; a power of two.
+    std::uint64_t capacity;
+
+    /// Absolute end position of the last published record.
+    alignas(64) std::atomic<std::uint64_t> head;
+
+    /// Absolute end position of the record being written.
+    alignas(64) std::atomic<std::uint64_t> reserve;
+};
+
+/// Consumer slots, the part of the shared state writable by consumers.
+struct consumer_table
+{
+    consumer_slot consumers[max_consumers];
+};
+
+/**
+ * @brief Header of a record in the data area.
+ *
+ * The header is followed by the URI of the changed parameter and the binary
+ * encoded value (see binary::encoder). Records are padded to
+ * @ref record_alignment.
+ */
+struct record_header
+{
+    /// Record size including header and padding.
+    std::uint32_t size;
+
+    /// Size of the URI or @ref padding_record.
+    std::uint32_t uri_size;
+
+    /// Record sequence number, incremented by one per record.
+    std::uint64_t sequence;
+
+    /// Time of the change in nanoseconds since epoch.
+    std::int64_t timestamp;
+};
+
+/**
+ * @brief Handshake message sent to new consumers.
+ *
+ * The message is accompanied by the file descriptors of the ring, of the
+ * consumer table and of the consumer's eventfd. It is followed on the socket
+ * by a snapshot of the current values, encoded like records in the data
+ * area with sequence number 0.
+ */
+struct handshake
+{
+    /// Index of the consumer slot assigned to the consumer.
+    std::uint32_t slot;
+
+    /// Size of the snapshot following the handshake in bytes.
+    std::uint32_t snapshot_size;
+
+    /// Absolute position at which the consumer starts reading.
+    std::uint64_t start;
+
+    /// Sequence number of the record at @c start.
+    std::uint64_t sequence;
+};
+
+/// Returns the offset of the data area within the shared memory.
+constexpr std::size_t data_offset()
+{
+    return (sizeof(ring_header) + 63) / 64 * 64;
+}
+
+} // namespace shm
+
+} // namespace decof
+
+#endif // DECOF_SHM_RING_H
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DECOF_SHM_SUBSCRIBER_H
+#define DECOF_SHM_SUBSCRIBER_H
+
+#include "ring.h"
+#include <decof/types.h>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
+
+namespace decof {
+
+namespace shm {
+
+/**
+ * @brief Client of a shm::publisher.
+ *
+ * The subscriber maps the publisher's update ring read-only and reads the
+ * parameter changes published after it attached, starting with the current
+ * values of all published parameters. The current values are received on
+ * attaching and have sequence number 0. Records overwritten before they
+ * were read are counted as lost.
+ *
+ * A subscriber instance must be used by a single thread only.
+ */
+class subscriber
+{
+  public:
+    struct record
+    {
+        std::string                           uri;
+        value_t                               value;
+        std::uint64_t                         sequence;
+        std::chrono::system_clock::time_point time;
+    };
+
+    /**
+     * @brief Attaches to a publisher.
+     *
+     * @param path Path of the publisher's Unix domain socket. Paths starting
+     * with a null character denote the Linux abstract namespace.
+     * @throw std::system_error if the publisher cannot be attached.
+     */
+    explicit subscriber(const std::string& path);
+    ~subscriber();
+
+    subscriber(const subscriber&) = delete;
+    subscriber& operator=(const subscriber&) = delete;
+
+    /**
+     * @brief Reads the next record without blocking.
+     *
+     * @return @c false if no record is available.
+     * @throw invalid_value_error if the ring contents are malformed.
+     */
+    bool try_read(record& rec);
+
+    /**
+     * @brief Reads the next record and waits for it if necessary.
+     *
+     * @return @c false if no record became available within @a timeout.
+     */
+    bool read(record& rec, std::chrono::milliseconds timeout);
+
+    /// Returns the number of records lost due to ring overruns.
+    std::uint64_t lost() const noexcept;
+
+    /**
+     * @brief Returns the eventfd signalled after waiting for records.
+     *
+     * The file descriptor can be integrated into event loops. It is only
+     * signalled after @ref read found no record available.
+     */
+    int native_handle() const noexcept;
+
+  private:
+    /// Receives the snapshot of current values following the handshake.
+    void receive_snapshot(std::size_t size);
+
+    int                socket_  = -1;
+    int                eventfd_ = -1;
+    std::size_t        mapping_size_;
+    const ring_header* header_;
+    consumer_table*    consumers_;
+    const char*        data_;
+
+    std::uint32_t slot_;
+    std::uint64_t position_;
+    std::uint64_t next_sequence_ = 0;
+    std::uint64_t lost_          = 0;
+    std::string   record_buf_;
+
+    std::deque<record> snapshot_;
+};
+
+} // namespace shm
+
+} // namespace decof
+
+#endif // DECOF_SHM_SUBSCRIBER_H
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DECOF_STATISTICS_H
+#define DECOF_STATISTICS_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace decof {
+
+/// Types of client requests.
+enum class request_type { get, set, signal, browse, tree, subscribe, unsubscribe };
+
+/// Protocols distinguished by the framework statistics.
+enum class protocol_type { cli, binary, scgi };
+
+/**
+ * @brief Process-wide statistics of the framework.
+ *
+ * The framework counts requests, request latencies, transferred bytes, live
+ * connections, queued publish updates and ticks. Each thread counts into
+ * counters of its own using relaxed atomic stores, so that counting neither
+ * locks nor contends. The counters of all threads are summed up by
+ * #collect(), which is meant to be called rarely, e.g., by a
+ * @ref statistics_node.
+ */
+namespace statistics {
+
+constexpr std::size_t request_types = 7;
+constexpr std::size_t protocols     = 3;
+
+/// Latency histogram bucket @c i counts latencies below 2^i microseconds
+/// and at least 2^(i-1) microseconds.
+constexpr std::size_t latency_buckets = 32;
+
+/// Sums of the counters of all threads.
+struct snapshot
+{
+    std::array<std::uint64_t, request_types>   requests{};
+    std::array<std::uint64_t, latency_buckets> latencies{};
+    std::array<std::uint64_t, protocols>       bytes_in{};
+    std::array<std::uint64_t, protocols>       bytes_out{};
+
+    std::int64_t connections = 0;
+    std::int64_t backlog     = 0;
+
+    std::uint64_t ticks         = 0;
+    std::uint64_t tick_time     = 0;
+    std::uint64_t tick_overruns = 0;
+};
+
+/// Counts a client request.
+void count_request(request_type type) noexcept;
+
+/// Records the time from receiving a request until its response is ready.
+void record_latency(std::chrono::steady_clock::duration latency) noexcept;
+
+/// Counts bytes received by a client context.
+void count_bytes_in(protocol_type protocol, std::size_t bytes) noexcept;
+
+/// Counts bytes sent by a client context.
+void count_bytes_out(protocol_type protocol, std::size_t bytes) noexcept;
+
+/// Adjusts the number of live connections.
+void add_connections(std::int64_t delta) noexcept;
+
+/// Adjusts the number of publish updates waiting to be sent.
+void add_backlog(std::int64_t delta) noexcept;
+
+/// Records a tick of the object dictionary and whether it overran its interval.
+void record_tick(std::chrono::steady_clock::duration duration, bool overrun) noexcept;
+
+/// Returns the sums of the counters of all threads, past and present.
+snapshot collect();
+
+/**
+ * @brief Returns a latency percentile in microseconds.
+ *
+ * The percentile is interpolated within the histogram bucket it falls into.
+ *
+ * @param latencies Latency histogram, e.g., the difference of two snapshots.
+ * @param percentile The percentile in the range [0, 1].
+ */
+double latency_percentile(const std::array<std::uint64_t, latency_buckets>& latencies, double percentile);
+
+} // namespace statistics
+
+} // namespace decof
+
+#endif // DECOF_STATISTICS_H
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DECOF_STATISTICS_NODE_H
+#define DECOF_STATISTICS_NODE_H
+
+#include "node.h"
+#include "statistics.h"
+#include "types.h"
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace decof {
+
+/**
+ * @brief Node exposing the framework statistics as readonly parameters.
+ *
+ * The node creates the following subtree:
+ *
+ * @verbatim
+   |-- requests-per-second: node
+   | |-- get, set, signal, browse, tree, subscribe, unsubscribe: real
+   |-- request-latency: node
+   | |-- p50, p90, p99: real (microseconds)
+   |-- bytes-in: node
+   | |-- cli, binary, scgi: integer
+   |-- bytes-out: node
+   | |-- cli, binary, scgi: integer
+   |-- connections: integer
+   |-- update-backlog: integer
+   |-- tick-duration: real (mean, microseconds)
+   |-- tick-overruns: integer
+   |-- tick-targets: integer
+   @endverbatim
+ *
+ * Rates, latency percentiles and the tick duration refer to the most recent
+ * sampling window. Clients can subscribe to all parameters. The values are
+ * polled with the object dictionary tick like those of any other external
+ * readonly parameter.
+ *
+ * The node must be created within the object dictionary strand like any
+ * other object and lives in the object dictionary's tree.
+ */
+class statistics_node : public node
+{
+  public:
+    /**
+     * @brief Constructor.
+     *
+     * @param name Node name.
+     * @param parent Parent node.
+     * @param window Minimum sampling window duration.
+     * @param readlevel Readlevel of the node and its parameters.
+     */
+    statistics_node(
+        const char*                         name,
+        node*                               parent,
+        std::chrono::steady_clock::duration window    = std::chrono::seconds(1),
+        userlevel_t                         readlevel = Normal);
+
+    virtual ~statistics_node();
+
+  private:
+    /// Takes a new sample if the sampling window has elapsed.
+    void sample();
+
+    double window_seconds() const;
+
+    template <typename F>
+    void add_real(const char* name, node* parent, F f);
+
+    template <typename F>
+    void add_integer(const char* name, node* parent, F f);
+
+    std::chrono::steady_clock::duration   window_;
+    userlevel_t                           readlevel_;
+    std::chrono::steady_clock::time_point previous_time_;
+    std::chrono::steady_clock::time_point current_time_;
+    statistics::snapshot                  previous_;
+    statistics::snapshot                  current_;
+
+    node requests_per_second_;
+    node request_latency_;
+    node bytes_in_;
+    node bytes_out_;
+
+    // Parameters must be destroyed before their parent nodes.
+    std::vector<std::unique_ptr<object>> parameters_;
+};
+
+} // namespace decof
+
+#endif // DECOF_STATISTICS_NODE_H
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DECOF_UDP_DATAGRAM_H
+#define DECOF_UDP_DATAGRAM_H
+
+#include <decof/types.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+namespace decof {
+
+namespace udp {
+
+/**
+ * @brief Kinds of records in a datagram.
+ *
+ * A datagram consists of a header with u8 version, u8 reserved, u16 record
+ * count and u64 datagram sequence number followed by the records. Each
+ * record starts with its u8 kind and u32 parameter id. All numbers are
+ * little endian.
+ *
+ * | Kind     | Payload                                                     |
+ * |----------|-------------------------------------------------------------|
+ * | value    | binary encoded value (see binary::encoder)                  |
+ * | announce | u16 length, fully qualified parameter name                  |
+ */
+enum class record_kind : std::uint8_t {
+    value    = 0x01,
+    announce = 0x02
+};
+
+/// Version of the datagram format.
+constexpr std::uint8_t datagram_version = 1;
+
+/// Size of the datagram header.
+constexpr std::size_t datagram_header_size = 12;
+
+/// Size of the record header.
+constexpr std::size_t record_header_size = 5;
+
+/**
+ * @brief Decoder of datagrams sent by a udp::publisher.
+ *
+ * The receiver resolves parameter ids by means of the announcements, which
+ * the publisher repeats regularly, and detects lost datagrams by gaps in the
+ * datagram sequence numbers. Value records of parameters not yet announced
+ * are skipped.
+ */
+class receiver
+{
+  public:
+    using value_handler = std::function<void(const std::string& uri, const value_t& value)>;
+
+    explicit receiver(value_handler handler);
+
+    /**
+     * @brief Decodes a datagram and invokes the handler for each value.
+     *
+     * @throw invalid_value_error if the datagram is malformed.
+     */
+    void receive(const char* data, std::size_t size);
+
+    /// Returns the number of datagrams lost or reordered.
+    std::uint64_t lost() const noexcept;
+
+    /// Returns the number of value records skipped for unknown parameter ids.
+    std::uint64_t unknown() const noexcept;
+
+  private:
+    value_handler                                  handler_;
+    std::unordered_map<std::uint32_t, std::string> uris_;
+    std::uint64_t                                  next_sequence_ = 0;
+    std::uint64_t                                  lost_          = 0;
+    std::uint64_t                                  unknown_       = 0;
+};
+
+} // namespace udp
+
+} // namespace decof
+
+#endif // DECOF_UDP_DATAGRAM_H
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef DECOF_UDP_PUBLISHER_H
+#define DECOF_UDP_PUBLISHER_H
+
+#include "datagram.h"
+#include <decof/client_context/client_context.h>
+#include <decof/types.h>
+#include <decof/userlevel.h>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/asio/strand.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace decof {
+
+namespace udp {
+
+/**
+ * @brief Publisher of parameter changes as UDP datagrams.
+ *
+ * The publisher sends the changes of the published parameters to a
+ * multicast group or a unicast destination, so that the number of receivers
+ * does not affect the server load. Changes are batched into datagrams: a
+ * datagram is sent once it holds the configured number of records or when
+ * the handlers currently queued on the strand have run. See datagram.h for
+ * the format and udp::receiver for the client side.
+ *
+ * All member functions and value changes of published parameters must be
+ * invoked on the given strand.
+ */
+class publisher : public client_context
+{
+  public:
+    using strand_t      = boost::asio::io_service::strand;
+    using endpoint_type = boost::asio::ip::udp::endpoint;
+
+    /**
+     * @brief Constructor.
+     *
+     * @param od Reference to the object dictionary.
+     * @param strand Reference to the Boost.Asio strand object that serializes
+     * accesses to the object dictionary.
+     * @param destination The multicast group or unicast destination.
+     * @param userlevel The publisher's userlevel.
+     */
+    publisher(
+        object_dictionary&   od,
+        strand_t&            strand,
+        const endpoint_type& destination,
+        userlevel_t          userlevel = Normal);
+    ~publisher();
+
+    std::string connection_type() const final;
+    std::string remote_endpoint() const final;
+
+    /// Sets the maximum number of records per datagram (default 32, at most
+    /// 65535 as the record count is a u16).
+    void batch_size(std::size_t size);
+
+    /// Sets the maximum datagram size (default 1472, i.e., a 1500 bytes MTU,
+    /// at most 65507). Records not fitting into a datagram of this size on
+    /// their own are dropped.
+    void max_datagram_size(std::size_t size);
+
+    /// Sets the number of datagrams after which all parameter ids are
+    /// announced again (default 100).
+    void announce_interval(std::size_t datagrams);
+
+    /// Sets the multicast time-to-live (default 1).
+    void multicast_hops(int hops);
+
+    /// Sets the interface multicast datagrams are sent on.
+    void multicast_interface(const boost::asio::ip::address_v4& address);
+
+    /**
+     * @brief Publishes the changes of a parameter or of all observable
+     * parameters below a node.
+     *
+     * @param uri Fully qualified name of the parameter or node.
+     * @throw invalid_parameter_error if the object does not exist.
+     */
+    void publish(const std::string& uri);
+
+    /// Stops publishing the changes of a parameter or node.
+    void unpublish(const std::string& uri);
+
+    /// Sends the pending records immediately.
+    void flush();
+
+    /// Returns the number of datagrams sent.
+    std::uint64_t sent() const noexcept;
+
+    /// Returns the number of datagrams that could not be sent.
+    std::uint64_t send_errors() const noexcept;
+
+    /// Returns the number of records dropped because they exceed the maximum
+    /// datagram size.
+    std::uint64_t dropped() const noexcept;
+
+  private:
+    void notify(const std::string& uri, const value_t& value);
+
+    /// Appends a record to the pending datagram.
+    void append_record(record_kind kind, std::uint32_t id, const std::string& payload);
+
+    /// Appends announcements of all parameter ids.
+    void announce_all();
+
+    /// Returns the announcement payload of a parameter name.
+    static std::string announcement(const std::string& uri);
+
+    strand_t&                    strand_;
+    endpoint_type                destination_;
+    boost::asio::ip::udp::socket socket_;
+
+    std::size_t batch_size_        = 32;
+    std::size_t max_datagram_size_ = 1472;
+    std::size_t announce_interval_ = 100;
+
+    std::unordered_map<std::string, std::uint32_t> ids_;
+    std::uint32_t                                  next_id_ = 0;
+
+    std::string   datagram_;
+    std::size_t   records_ = 0;
+    std::string   payload_;
+    bool          flush_scheduled_    = false;
+    std::size_t   since_announcement_ = 0;
+    std::uint64_t sequence_           = 0;
+    std::uint64_t sent_               = 0;
+    std::uint64_t send_errors_        = 0;
+    std::uint64_t dropped_            = 0;
+    bool          announcing_         = false;
+
+    /// Expires on destruction for handlers posted to the strand.
+    std::shared_ptr<void> alive_;
+};
+
+} // namespace udp
+
+} // namespace decof
+
+#endif // DECOF_UDP_PUBLISHER_H
@@ -34,7 +34,15 @@ bool asio_executor::closed()
 
 bool asio_executor::try_executing_one()
 {
-    return false;
+    if (strand_.running_in_this_thread())
+        return false;
+
+    return strand_.context().poll_one() > 0;
+}
+
+executor_metrics asio_executor::metrics() const noexcept
+{
+    return statistics_.snapshot();
 }
 
 } // namespace decof
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <decof/asio_executor/thread_pool_executor.h>
+#include <algorithm>
+#include <tuple>
+
+namespace {
+
+/// The pool and queue index of the current worker thread.
+thread_local const decof::thread_pool_executor* current_pool  = nullptr;
+thread_local std::size_t                        current_index = 0;
+
+} // Anonymous namespace
+
+namespace decof {
+
+thread_pool_executor::thread_pool_executor(std::size_t threads)
+{
+    threads = std::max<std::size_t>(threads, 1);
+
+    for (std::size_t i = 0; i < threads; ++i)
+        queues_.push_back(std::make_unique<worker_queue>());
+
+    for (std::size_t i = 0; i < threads; ++i)
+        threads_.emplace_back([this, i]() { run(i); });
+}
+
+thread_pool_executor::~thread_pool_executor()
+{
+    close();
+    join();
+}
+
+void thread_pool_executor::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+    }
+    condition_.notify_all();
+}
+
+bool thread_pool_executor::closed()
+{
+    return closed_;
+}
+
+bool thread_pool_executor::try_executing_one()
+{
+    work              w;
+    clock::time_point submission;
+
+    if (!take(current_pool == this ? current_index : 0, w, submission))
+        return false;
+
+    statistics_.started(submission);
+    w();
+    return true;
+}
+
+void thread_pool_executor::join()
+{
+    for (auto& thread : threads_) {
+        if (thread.joinable() && thread.get_id() != std::this_thread::get_id())
+            thread.join();
+    }
+}
+
+std::size_t thread_pool_executor::size() const noexcept
+{
+    return threads_.size();
+}
+
+executor_metrics thread_pool_executor::metrics() const noexcept
+{
+    return statistics_.snapshot();
+}
+
+void thread_pool_executor::push(work&& w)
+{
+    // Closures spawned by a worker are likely to work on data still in its
+    // cache, while external submissions must not overtake each other
+    auto& queue = current_pool == this ? *queues_[current_index] : submissions_;
+
+    // The pending count never drops below the number of queued closures
+    pending_.fetch_add(1);
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.closures.emplace_back(std::move(w), statistics_.submitted());
+    }
+
+    // Taking the lock prevents the wakeup from getting lost in between a
+    // worker's check of the pending count and its wait
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+    }
+    condition_.notify_one();
+}
+
+bool thread_pool_executor::take(std::size_t index, work& w, clock::time_point& submission)
+{
+    const bool worker = current_pool == this;
+
+    // The own queue is used last in, first out
+    if (worker) {
+        auto&                       queue = *queues_[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.closures.empty()) {
+            std::tie(w, submission) = std::move(queue.closures.back());
+            queue.closures.pop_back();
+            pending_.fetch_sub(1);
+            return true;
+        }
+    }
+
+    // External submissions are run first in, first out
+    {
+        std::lock_guard<std::mutex> lock(submissions_.mutex);
+        if (!submissions_.closures.empty()) {
+            std::tie(w, submission) = std::move(submissions_.closures.front());
+            submissions_.closures.pop_front();
+            pending_.fetch_sub(1);
+            return true;
+        }
+    }
+
+    // Other queues are robbed first in, first out
+    for (std::size_t i = worker ? 1 : 0; i < queues_.size(); ++i) {
+        auto&                       queue = *queues_[(index + i) % queues_.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.closures.empty()) {
+            std::tie(w, submission) = std::move(queue.closures.front());
+            queue.closures.pop_front();
+            pending_.fetch_sub(1);
+            statistics_.stolen();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void thread_pool_executor::run(std::size_t index)
+{
+    current_pool  = this;
+    current_index = index;
+
+    for (;;) {
+        work              w;
+        clock::time_point submission;
+
+        if (take(index, w, submission)) {
+            statistics_.started(submission);
+            w();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this]() { return pending_ > 0 || closed_; });
+        if (closed_ && pending_ == 0)
+            return;
+    }
+}
+
+} // namespace decof
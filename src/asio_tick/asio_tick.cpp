@@ -15,6 +15,7 @@
  */
 
 #include "asio_tick.h"
+#include <decof/statistics.h>
 
 namespace decof {
 
@@ -22,7 +23,7 @@ namespace asio_tick {
 
 asio_tick_context::asio_tick_context(
     decof::object_dictionary& obj_dict, boost::asio::io_service::strand& strand, std::chrono::milliseconds interval)
-  : client_context(obj_dict), strand_(strand), timer_(strand.get_io_service()), interval_(interval)
+  : client_context(obj_dict), strand_(strand), timer_(strand.context()), interval_(interval)
 {
 }
 
@@ -35,7 +36,11 @@ void asio_tick_context::preload()
 void asio_tick_context::tick_handler(const boost::system::error_code& error)
 {
     if (error != boost::asio::error::operation_aborted) {
+        const auto start = std::chrono::steady_clock::now();
         tick();
+
+        const auto duration = std::chrono::steady_clock::now() - start;
+        statistics::record_tick(duration, duration > interval_);
         preload();
     }
 }
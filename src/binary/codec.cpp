@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <decof/binary/codec.h>
+#include <decof/exceptions.h>
+#include <limits>
+#include <variant>
+
+namespace {
+
+using namespace decof;
+using binary::type_tag;
+
+type_tag tag_of(const scalar_t& arg)
+{
+    switch (arg.index()) {
+        case 0:
+            return type_tag::boolean;
+        case 1:
+            return type_tag::integer;
+        case 2:
+            return type_tag::real;
+        case 3:
+            return type_tag::string;
+        default:
+            return type_tag::binary;
+    }
+}
+
+void write_size(std::string& out, std::size_t size)
+{
+    if (size > std::numeric_limits<std::uint32_t>::max())
+        throw invalid_value_error();
+
+    write_le(out, static_cast<std::uint32_t>(size));
+}
+
+} // Anonymous namespace
+
+namespace decof {
+
+namespace binary {
+
+encoder::encoder(std::string& out) : out_(out)
+{
+}
+
+void encoder::operator()(const value_t& arg) const
+{
+    std::visit(*this, arg);
+}
+
+void encoder::operator()(const scalar_t& arg) const
+{
+    std::visit(*this, arg);
+}
+
+void encoder::operator()(const sequence_t& arg) const
+{
+    out_.push_back(static_cast<char>(type_tag::sequence));
+
+    const type_tag elem_tag = arg.empty() ? type_tag::none : tag_of(arg.front());
+    out_.push_back(static_cast<char>(elem_tag));
+    write_size(out_, arg.size());
+
+    // Preallocate fixed size elements so that they are written as raw array
+    if (elem_tag == type_tag::integer || elem_tag == type_tag::real)
+        out_.reserve(out_.size() + arg.size() * 8);
+    else if (elem_tag == type_tag::boolean)
+        out_.reserve(out_.size() + arg.size());
+
+    for (const auto& elem : arg) {
+        if (tag_of(elem) != elem_tag)
+            throw invalid_value_error();
+        payload(elem);
+    }
+}
+
+void encoder::operator()(const tuple_t& arg) const
+{
+    out_.push_back(static_cast<char>(type_tag::tuple));
+    write_size(out_, arg.size());
+
+    for (const auto& elem : arg)
+        std::visit(*this, elem);
+}
+
+void encoder::operator()(const boolean_t& arg) const
+{
+    out_.push_back(static_cast<char>(type_tag::boolean));
+    out_.push_back(arg ? '\1' : '\0');
+}
+
+void encoder::operator()(const integer_t& arg) const
+{
+    out_.push_back(static_cast<char>(type_tag::integer));
+    write_le(out_, static_cast<std::int64_t>(arg));
+}
+
+void encoder::operator()(const real_t& arg) const
+{
+    out_.push_back(static_cast<char>(type_tag::real));
+    write_le(out_, arg);
+}
+
+void encoder::operator()(const string_t& arg) const
+{
+    out_.push_back(static_cast<char>(type_tag::string));
+    payload(arg);
+}
+
+void encoder::operator()(const binary_t& arg) const
+{
+    out_.push_back(static_cast<char>(type_tag::binary));
+    payload(arg);
+}
+
+void encoder::payload(const scalar_t& arg) const
+{
+    switch (arg.index()) {
+        case 0:
+            out_.push_back(std::get<boolean_t>(arg) ? '\1' : '\0');
+            break;
+        case 1:
+            write_le(out_, static_cast<std::int64_t>(std::get<integer_t>(arg)));
+            break;
+        case 2:
+            write_le(out_, std::get<real_t>(arg));
+            break;
+        case 3: {
+            const auto& str = std::get<string_t>(arg);
+            write_size(out_, str.size());
+            out_.append(str);
+            break;
+        }
+        default: {
+            const auto& str = std::get<binary_t>(arg);
+            write_size(out_, str.size());
+            out_.append(str);
+            break;
+        }
+    }
+}
+
+decoder::decoder(const char* first, const char* last) : pos_(first), last_(last)
+{
+}
+
+value_t decoder::value()
+{
+    const auto tag = static_cast<type_tag>(read<std::uint8_t>());
+
+    if (tag == type_tag::sequence) {
+        const auto elem_tag = static_cast<type_tag>(read<std::uint8_t>());
+        const auto count    = read<std::uint32_t>();
+
+        if (count > 0 && (elem_tag == type_tag::none || elem_tag > type_tag::binary))
+            throw invalid_value_error();
+
+        // Every element occupies at least one byte
+        require(count);
+
+        sequence_t seq;
+        for (std::uint32_t i = 0; i < count; ++i)
+            seq.push_back(scalar(elem_tag));
+        return seq;
+    } else if (tag == type_tag::tuple) {
+        const auto count = read<std::uint32_t>();
+        require(count);
+
+        tuple_t tup;
+        for (std::uint32_t i = 0; i < count; ++i) {
+            const auto elem_tag = static_cast<type_tag>(read<std::uint8_t>());
+            tup.push_back(scalar(elem_tag));
+        }
+        return tup;
+    }
+
+    return scalar(tag);
+}
+
+const char* decoder::position() const
+{
+    return pos_;
+}
+
+scalar_t decoder::scalar(type_tag tag)
+{
+    switch (tag) {
+        case type_tag::boolean:
+            return read<std::uint8_t>() != 0;
+        case type_tag::integer:
+            return static_cast<integer_t>(read<std::int64_t>());
+        case type_tag::real:
+            return read<double>();
+        case type_tag::string:
+        case type_tag::binary: {
+            const auto size = read<std::uint32_t>();
+            require(size);
+            std::string str(pos_, size);
+            pos_ += size;
+            if (tag == type_tag::string)
+                return string_t(std::move(str));
+            return binary_t(std::move(str));
+        }
+        default:
+            throw invalid_value_error();
+    }
+}
+
+void decoder::require(std::size_t n) const
+{
+    if (static_cast<std::size_t>(last_ - pos_) < n)
+        throw invalid_value_error();
+}
+
+} // namespace binary
+
+} // namespace decof
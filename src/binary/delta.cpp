@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <decof/binary/codec.h>
+#include <decof/binary/delta.h>
+#include <decof/exceptions.h>
+#include <algorithm>
+#include <cstring>
+#include <variant>
+
+namespace {
+
+using namespace decof;
+using namespace decof::binary;
+
+/// Size of blocks compared at once when searching for changes.
+const std::size_t block_size = 64;
+
+/// Layout of patchable encoded values.
+struct array_layout
+{
+    type_tag    value_tag;
+    type_tag    elem_tag;
+    std::size_t elem_size;
+    std::size_t count;
+    std::size_t offset;
+};
+
+bool patchable(const std::string& encoded, array_layout& layout)
+{
+    if (encoded.size() < 5)
+        return false;
+
+    layout.value_tag = static_cast<type_tag>(encoded[0]);
+
+    if (layout.value_tag == type_tag::binary) {
+        layout.elem_tag  = type_tag::binary;
+        layout.elem_size = 1;
+        layout.count     = read_le<std::uint32_t>(encoded.data() + 1);
+        layout.offset    = 5;
+        return true;
+    } else if (layout.value_tag == type_tag::sequence && encoded.size() >= 6) {
+        layout.elem_tag = static_cast<type_tag>(encoded[1]);
+        layout.count    = read_le<std::uint32_t>(encoded.data() + 2);
+        layout.offset   = 6;
+
+        if (layout.elem_tag == type_tag::boolean)
+            layout.elem_size = 1;
+        else if (layout.elem_tag == type_tag::integer || layout.elem_tag == type_tag::real)
+            layout.elem_size = 8;
+        else
+            return false;
+
+        return true;
+    }
+
+    return false;
+}
+
+std::uint32_t read_u32(const char*& pos, const char* last)
+{
+    if (last - pos < 4)
+        throw invalid_value_error();
+
+    auto retval = read_le<std::uint32_t>(pos);
+    pos += 4;
+    return retval;
+}
+
+} // Anonymous namespace
+
+namespace decof {
+
+namespace binary {
+
+std::vector<element_range> changed_ranges(const char* lhs,
+                                          const char* rhs,
+                                          std::size_t count,
+                                          std::size_t elem_size,
+                                          std::size_t min_gap)
+{
+    std::vector<element_range> retval;
+
+    const std::size_t size = count * elem_size;
+    std::size_t       pos  = 0;
+
+    while (pos < size) {
+        // Skip equal blocks
+        const std::size_t len = std::min(block_size, size - pos);
+        if (std::memcmp(lhs + pos, rhs + pos, len) == 0) {
+            pos += len;
+            continue;
+        }
+
+        // Inspect differing block elementwise
+        std::size_t elem = pos / elem_size;
+        const auto  end  = std::min(count, (pos + len + elem_size - 1) / elem_size);
+        for (; elem < end; ++elem) {
+            if (std::memcmp(lhs + elem * elem_size, rhs + elem * elem_size, elem_size) == 0)
+                continue;
+
+            if (!retval.empty() && elem < retval.back().first + retval.back().second + min_gap)
+                retval.back().second = elem + 1 - retval.back().first;
+            else
+                retval.emplace_back(elem, 1);
+        }
+
+        pos = end * elem_size;
+    }
+
+    return retval;
+}
+
+bool encode_patch(std::string& out, const std::string& previous, const std::string& current)
+{
+    array_layout prev_layout, cur_layout;
+    if (!patchable(previous, prev_layout) || !patchable(current, cur_layout))
+        return false;
+
+    if (prev_layout.value_tag != cur_layout.value_tag || prev_layout.elem_tag != cur_layout.elem_tag ||
+        prev_layout.count != cur_layout.count || previous.size() != current.size())
+        return false;
+
+    // Merge ranges unless the gap is larger than the range header
+    const std::size_t min_gap = std::max<std::size_t>(1, 8 / cur_layout.elem_size);
+    const auto        ranges  = changed_ranges(previous.data() + prev_layout.offset,
+                                       current.data() + cur_layout.offset,
+                                       cur_layout.count,
+                                       cur_layout.elem_size,
+                                       min_gap);
+
+    std::size_t patch_size = 10;
+    for (const auto& range : ranges)
+        patch_size += 8 + range.second * cur_layout.elem_size;
+
+    if (patch_size >= current.size())
+        return false;
+
+    out.reserve(out.size() + patch_size);
+    out.push_back(static_cast<char>(cur_layout.value_tag));
+    out.push_back(static_cast<char>(cur_layout.elem_tag));
+    write_le(out, static_cast<std::uint32_t>(cur_layout.count));
+    write_le(out, static_cast<std::uint32_t>(ranges.size()));
+
+    for (const auto& range : ranges) {
+        write_le(out, static_cast<std::uint32_t>(range.first));
+        write_le(out, static_cast<std::uint32_t>(range.second));
+        out.append(current.data() + cur_layout.offset + range.first * cur_layout.elem_size,
+                   range.second * cur_layout.elem_size);
+    }
+
+    return true;
+}
+
+void apply_patch(value_t& value, const char* first, const char* last)
+{
+    if (last - first < 2)
+        throw invalid_value_error();
+
+    const auto value_tag = static_cast<type_tag>(*first++);
+    const auto elem_tag  = static_cast<type_tag>(*first++);
+    const auto count     = read_u32(first, last);
+    auto       ranges    = read_u32(first, last);
+
+    if (value_tag == type_tag::binary) {
+        auto* str = std::get_if<scalar_t>(&value);
+        auto* bin = str != nullptr ? std::get_if<binary_t>(str) : nullptr;
+        if (bin == nullptr || bin->size() != count)
+            throw invalid_value_error();
+
+        while (ranges-- > 0) {
+            const auto index = read_u32(first, last);
+            const auto size  = read_u32(first, last);
+            if (index + static_cast<std::size_t>(size) > count || static_cast<std::size_t>(last - first) < size)
+                throw invalid_value_error();
+
+            bin->replace(index, size, first, size);
+            first += size;
+        }
+    } else if (value_tag == type_tag::sequence) {
+        auto* seq = std::get_if<sequence_t>(&value);
+        if (seq == nullptr || seq->size() != count)
+            throw invalid_value_error();
+
+        const std::size_t elem_size = elem_tag == type_tag::boolean ? 1 : 8;
+        if (elem_tag != type_tag::boolean && elem_tag != type_tag::integer && elem_tag != type_tag::real)
+            throw invalid_value_error();
+
+        while (ranges-- > 0) {
+            const auto index = read_u32(first, last);
+            const auto size  = read_u32(first, last);
+            if (index + static_cast<std::size_t>(size) > count ||
+                static_cast<std::size_t>(last - first) / elem_size < size)
+                throw invalid_value_error();
+
+            for (std::size_t i = index; i < index + size; ++i, first += elem_size) {
+                if (elem_tag == type_tag::boolean)
+                    (*seq)[i] = *first != 0;
+                else if (elem_tag == type_tag::integer)
+                    (*seq)[i] = static_cast<integer_t>(read_le<std::int64_t>(first));
+                else
+                    (*seq)[i] = read_le<double>(first);
+            }
+        }
+    } else
+        throw invalid_value_error();
+}
+
+} // namespace binary
+
+} // namespace decof
@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <decof/binary/codec.h>
+#include <decof/binary/delta.h>
+#include <decof/binary/pubsub_context.h>
+#include <decof/exceptions.h>
+#include <decof/object.h>
+#include <decof/object_dictionary.h>
+#include <decof/statistics.h>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <chrono>
+#include <functional>
+#include <limits>
+
+using boost::system::error_code;
+
+namespace {
+
+using namespace decof::binary;
+
+/// Fills in the frame header reserved at the beginning of @a frame.
+void patch_frame_header(std::string& frame, frame_type type)
+{
+    std::string header;
+    write_frame_header(header, type, frame.size() - frame_header_size);
+    frame.replace(0, frame_header_size, header);
+}
+
+} // Anonymous namespace
+
+namespace decof {
+
+namespace binary {
+
+void write_frame_header(std::string& out, frame_type type, std::size_t body_size)
+{
+    write_le(out, static_cast<std::uint32_t>(body_size + 1));
+    out.push_back(static_cast<char>(type));
+}
+
+pubsub_context::pubsub_context(strand_t& strand, socket_t&& socket, object_dictionary& od, userlevel_t userlevel)
+  : client_context(od, userlevel),
+    dictionary_strand_(strand),
+    strand_(strand.context()),
+    flush_scheduler_(boost::asio::use_service<flush_scheduler>(strand.context())),
+    socket_(std::move(socket))
+{
+    // The endpoint is also reported from the object dictionary strand
+    connection_type_ = transport_name(socket_);
+    remote_endpoint_ = peer_name(socket_);
+
+    boost::asio::socket_base::send_buffer_size option;
+    socket_.get_option(option);
+    socket_send_buf_size_ = option.value();
+}
+
+std::string pubsub_context::connection_type() const
+{
+    return connection_type_;
+}
+
+std::string pubsub_context::remote_endpoint() const
+{
+    return remote_endpoint_;
+}
+
+void pubsub_context::preload()
+{
+    auto self = shared_from_this();
+    boost::asio::async_read(
+        socket_, boost::asio::buffer(header_), strand_.wrap([self](const error_code& err, std::size_t bytes) {
+            self->header_handler(err, bytes);
+        }));
+}
+
+void pubsub_context::header_handler(const error_code& error, std::size_t bytes_transferred)
+{
+    if (error) {
+        close();
+        return;
+    }
+
+    statistics::count_bytes_in(protocol_type::binary, bytes_transferred);
+
+    const auto length = read_le<std::uint32_t>(header_.data());
+    if (length == 0 || length > max_request_size) {
+        // Framing is lost, so the connection cannot be continued
+        close();
+        return;
+    }
+
+    inbuf_.resize(length - 1);
+
+    auto self = shared_from_this();
+    boost::asio::async_read(
+        socket_, boost::asio::buffer(inbuf_), strand_.wrap([self](const error_code& err, std::size_t bytes) {
+            self->body_handler(err, bytes);
+        }));
+}
+
+void pubsub_context::body_handler(const error_code& error, std::size_t bytes_transferred)
+{
+    if (!error) {
+        statistics::count_bytes_in(protocol_type::binary, bytes_transferred);
+        process_request(static_cast<frame_type>(header_[4]), std::string(inbuf_.begin(), inbuf_.end()));
+        preload();
+    } else
+        close();
+}
+
+void pubsub_context::write_handler(const error_code& error, std::size_t bytes_transferred)
+{
+    outbuf_.consume(bytes_transferred);
+    statistics::count_bytes_out(protocol_type::binary, bytes_transferred);
+
+    if (!error) {
+        writing_active_ = false;
+        preload_writing();
+    } else
+        close();
+}
+
+void pubsub_context::notify(const std::string& uri, const value_t& value)
+{
+    if (pending_updates_.push(uri, value)) {
+        auto self = shared_from_this();
+        flush_scheduler_.schedule(strand_, [self]() { self->preload_writing(); });
+    }
+}
+
+void pubsub_context::preload_writing()
+{
+    if (writing_active_)
+        return;
+
+    cli::update_queue::update update;
+    while (outbuf_.size() < socket_send_buf_size_ && pending_updates_.pop_front(update)) {
+        const auto& [uri, value, time] = update;
+
+        auto it = ids_.find(uri);
+        if (it == ids_.end())
+            continue;
+
+        // Reserve space for the frame header which is filled in afterwards
+        frame_.assign(frame_header_size, '\0');
+        write_le(frame_, it->second);
+        write_le(frame_,
+                 static_cast<std::int64_t>(
+                     std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()).count()));
+        patch_frame_header(frame_, encode_value(it->second, value));
+
+        outbuf_.append(std::move(frame_));
+    }
+
+    if (outbuf_.size() == 0)
+        return;
+
+    auto self = shared_from_this();
+    boost::asio::async_write(socket_, outbuf_.data(), strand_.wrap([self](const error_code& err, std::size_t bytes) {
+        self->write_handler(err, bytes);
+    }));
+
+    writing_active_ = true;
+}
+
+frame_type pubsub_context::encode_value(std::uint32_t id, const value_t& value)
+{
+    if (!delta_updates_) {
+        std::visit(encoder(frame_), value);
+        return frame_type::update;
+    }
+
+    encoded_.clear();
+    std::visit(encoder(encoded_), value);
+
+    // Only sequences and binary values are subject to delta encoding
+    const auto tag = static_cast<type_tag>(encoded_[0]);
+    if (tag != type_tag::sequence && tag != type_tag::binary) {
+        frame_ += encoded_;
+        return frame_type::update;
+    }
+
+    auto& state  = delta_states_[id];
+    auto  retval = frame_type::update;
+
+    if (!state.encoded.empty() && state.patches + 1 < keyframe_interval_ &&
+        encode_patch(frame_, state.encoded, encoded_)) {
+        ++state.patches;
+        retval = frame_type::patch;
+    } else {
+        frame_ += encoded_;
+        state.patches = 0;
+    }
+
+    state.encoded.swap(encoded_);
+    return retval;
+}
+
+void pubsub_context::close()
+{
+    // Observations belong to the object dictionary strand
+    auto self = shared_from_this();
+    dictionary_strand_.post([self]() { self->unobserve_all(); });
+
+    if (!socket_.is_open())
+        return;
+
+    error_code ec;
+    socket_.close(ec);
+}
+
+void pubsub_context::process_request(frame_type type, const std::string& body)
+{
+    try {
+        // Subscriptions are handed over to the object dictionary strand
+        auto self = shared_from_this();
+        if (type == frame_type::subscribe) {
+            statistics::count_request(request_type::subscribe);
+            dictionary_strand_.post([self, body]() { self->subscribe(body); });
+        } else if (type == frame_type::unsubscribe) {
+            statistics::count_request(request_type::unsubscribe);
+            dictionary_strand_.post([self, body]() { self->unsubscribe(body); });
+        } else if (type == frame_type::options) {
+            if (body.size() != 5)
+                throw parse_error();
+
+            delta_updates_     = (body[0] & delta_updates) != 0;
+            keyframe_interval_ = read_le<std::uint32_t>(body.data() + 1);
+            if (keyframe_interval_ == 0)
+                keyframe_interval_ = default_keyframe_interval;
+
+            delta_states_.clear();
+        } else
+            throw unknown_operation_error();
+    } catch (runtime_error& ex) {
+        send_error(ex.code(), ex.what());
+    } catch (...) {
+        send_error(UNKNOWN_ERROR, "Unknown error");
+    }
+
+    preload_writing();
+}
+
+void pubsub_context::subscribe(const std::string& uri)
+{
+    try {
+        auto obj = object_dictionary_.find_descendant_object(uri);
+        if (obj == nullptr)
+            throw invalid_parameter_error();
+
+        auto self = shared_from_this();
+        strand_.post([self, uri, fq_name = obj->fq_name()]() { self->announce(uri, fq_name); });
+    } catch (...) {
+        post_error();
+    }
+}
+
+void pubsub_context::announce(const std::string& uri, const std::string& fq_name)
+{
+    // Announce the parameter id before the initial value
+    auto it = ids_.find(fq_name);
+    if (it == ids_.end()) {
+        it = ids_.emplace(fq_name, static_cast<std::uint32_t>(ids_.size())).first;
+
+        std::string frame;
+        write_frame_header(frame, frame_type::announce, sizeof(std::uint32_t) + uri.size());
+        write_le(frame, it->second);
+        frame += uri;
+        outbuf_.append(std::move(frame));
+    }
+
+    // The initial value is always sent in full
+    delta_states_.erase(it->second);
+
+    auto self = shared_from_this();
+    dictionary_strand_.post([self, uri]() {
+        try {
+            self->observe(self->object_dictionary_.find_descendant_object(uri),
+                          std::bind(&pubsub_context::notify, self.get(), std::placeholders::_1, std::placeholders::_2));
+        } catch (...) {
+            self->post_error();
+        }
+    });
+
+    preload_writing();
+}
+
+void pubsub_context::unsubscribe(const std::string& uri)
+{
+    try {
+        auto obj = object_dictionary_.find_descendant_object(uri);
+        if (obj == nullptr)
+            throw invalid_parameter_error();
+
+        unobserve(obj);
+
+        auto self = shared_from_this();
+        strand_.post([self, fq_name = obj->fq_name()]() {
+            auto it = self->ids_.find(fq_name);
+            if (it != self->ids_.end())
+                self->delta_states_.erase(it->second);
+        });
+    } catch (...) {
+        post_error();
+    }
+}
+
+void pubsub_context::send_error(int code, const char* what)
+{
+    const std::string message(what);
+
+    std::string frame;
+    write_frame_header(frame, frame_type::error, sizeof(std::uint32_t) + message.size());
+    write_le(frame, static_cast<std::uint32_t>(code));
+    frame += message;
+    outbuf_.append(std::move(frame));
+}
+
+void pubsub_context::post_error()
+{
+    int         code = UNKNOWN_ERROR;
+    std::string what = "Unknown error";
+
+    try {
+        throw;
+    } catch (runtime_error& ex) {
+        code = ex.code();
+        what = ex.what();
+    } catch (...) {
+    }
+
+    auto self = shared_from_this();
+    strand_.post([self, code, what]() {
+        self->send_error(code, what.c_str());
+        self->preload_writing();
+    });
+}
+
+} // namespace binary
+
+} // namespace decof
@@ -43,6 +43,14 @@ void cli_context_base::install_request_callback(const cli_context_base::request_
     request_cb_ = request_cb;
 }
 
+void cli_context_base::report_request(request_t request_type, const std::string& request) const
+{
+    statistics::count_request(request_type);
+
+    if (request_cb_)
+        request_cb_(request_type, request, remote_endpoint());
+}
+
 } // namespace cli
 
 } // namespace decof
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "browse_visitor.h"
+#include "encoder.h"
+#include "parser.h"
+#include "tree_visitor.h"
+#include <decof/cli/clisrv_context_base.h>
+#include <decof/exceptions.h>
+#include <decof/object.h>
+#include <decof/object_dictionary.h>
+#include <decof/types.h>
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/algorithm/string/trim.hpp>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <exception>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <variant>
+
+namespace {
+
+const std::string_view prompt("> ");
+
+/// Number of records reported by the 'heat' command by default.
+constexpr std::size_t default_heat_count = 10;
+
+/// Formats the error response for the exception @a error.
+std::string error_line(std::exception_ptr error)
+{
+    std::ostringstream out;
+    try {
+        std::rethrow_exception(error);
+    } catch (decof::runtime_error& ex) {
+        out << "ERROR " << ex.code() << ": " << ex.what() << "\n";
+    } catch (...) {
+        out << "ERROR " << decof::UNKNOWN_ERROR << ": "
+            << "Unknown error\n";
+    }
+
+    return out.str();
+}
+
+} // Anonymous namespace
+
+namespace decof {
+
+namespace cli {
+
+void clisrv_context_base::append_greeting(output_buffer& outbuf)
+{
+    outbuf.append_static("DeCoF command line\n");
+    outbuf.append_static(prompt);
+}
+
+bool clisrv_context_base::parse_request(const std::string& line, request& req, reply& rep)
+{
+    // Trim whitespace and parantheses
+    std::string trimmed_request = boost::algorithm::trim_copy_if(line, boost::is_any_of(" \f\n\r\t\v()"));
+
+    // Ignore empty request
+    if (trimmed_request.empty()) {
+        rep.ignored = true;
+        return false;
+    }
+
+    // Read operation and uri
+    std::stringstream ss_in(trimmed_request);
+    ss_in >> req.op >> req.uri;
+    std::transform(req.op.begin(), req.op.end(), req.op.begin(), ::tolower);
+
+    // Remove optional "'" from parameter name
+    if (!req.uri.empty() && req.uri[0] == '\'')
+        req.uri.erase(0, 1);
+
+    req.line = line;
+
+    try {
+        if (req.op == "exec" && req.uri == "change-ul") {
+            // (exec 'change-ul <userlevel> "<passwd>")
+            int ul = std::numeric_limits<int>::max();
+
+            ss_in >> ul >> std::ws;
+            std::getline(ss_in, req.password);
+            boost::algorithm::trim_if(req.password, boost::is_any_of("\""));
+            req.userlevel = static_cast<userlevel_t>(ul);
+        } else if (req.op == "heat") {
+            // (heat [<count>] [count|time])
+            std::string key = req.uri;
+            req.count       = default_heat_count;
+            if (!req.uri.empty() && std::isdigit(static_cast<unsigned char>(req.uri[0]))) {
+                req.count = std::stoul(req.uri);
+                key.clear();
+                ss_in >> key;
+            }
+
+            if (!key.empty() && key != "count" && key != "time")
+                throw parse_error();
+
+            req.sort_key = key == "time" ? heat_map::sort_key::time : heat_map::sort_key::count;
+        } else if (ss_in.peek() != std::stringstream::traits_type::eof()) {
+            // Parse optional value string using flexc++/bisonc++ parser
+            parser parser(ss_in);
+            parser.parse();
+            req.value = parser.result();
+        }
+    } catch (...) {
+        rep.error = error_line(std::current_exception());
+        return false;
+    }
+
+    return true;
+}
+
+void clisrv_context_base::evaluate_request(const request& req, reply& rep)
+{
+    const auto& op  = req.op;
+    const auto& uri = req.uri;
+
+    try {
+        if (op == "exec" && uri == "change-ul") {
+            // Apply special handling for the 'change-ul' command
+            if (!userlevel_cb_(*this, req.userlevel, req.password))
+                throw access_denied_error();
+
+            client_context::userlevel(req.userlevel);
+            rep.value = static_cast<integer_t>(userlevel());
+        } else if (op == "heat") {
+            // Apply special handling for the 'heat' command
+            report_request(request_t::tree, req.line);
+            rep.heat = heat_report(req.count, req.sort_key);
+        } else if ((op == "get" || op == "param-ref") && !uri.empty() && !req.value) {
+            report_request(request_t::get, req.line);
+
+            // Apply special handling for 'ul' parameter
+            if (uri == "ul")
+                rep.value = static_cast<integer_t>(userlevel());
+            else
+                rep.value = get_parameter(object_dictionary_.find_descendant_object(uri));
+        } else if ((op == "set" || op == "param-set!") && !uri.empty() && req.value) {
+            report_request(request_t::set, req.line);
+
+            const auto obj = object_dictionary_.find_descendant_object(uri);
+            set_parameter(obj, *req.value);
+
+            rep.text = "0\n";
+        } else if ((op == "signal" || op == "exec") && !uri.empty() && !req.value) {
+            report_request(request_t::signal, req.line);
+
+            const auto obj = object_dictionary_.find_descendant_object(uri);
+            signal_event(obj);
+
+            rep.text = "()\n";
+        } else if ((op == "browse" || op == "param-disp") && !req.value) {
+            report_request(request_t::browse, req.line);
+
+            object* obj = &object_dictionary_;
+            if (!uri.empty()) {
+                obj = object_dictionary_.find_descendant_object(uri);
+            }
+
+            std::ostringstream temp_ss;
+            browse_visitor     visitor(temp_ss);
+
+            browse_object(obj, &visitor);
+            rep.text = std::move(temp_ss).str();
+        } else if (op == "tree" && !req.value) {
+            report_request(request_t::tree, req.line);
+
+            object* obj = &object_dictionary_;
+            if (!uri.empty()) {
+                obj = object_dictionary_.find_descendant_object(uri);
+            }
+
+            std::ostringstream temp_ss;
+            tree_visitor       visitor(temp_ss);
+
+            browse_object(obj, &visitor);
+            rep.text = std::move(temp_ss).str();
+        } else
+            throw parse_error();
+    } catch (...) {
+        rep.error = error_line(std::current_exception());
+    }
+}
+
+void clisrv_context_base::encode_reply(reply rep, output_buffer& outbuf)
+{
+    if (rep.ignored)
+        return;
+
+    output_streambuf sbuf(outbuf);
+    std::ostream     out(&sbuf);
+
+    if (!rep.error.empty()) {
+        out << rep.error;
+    } else if (rep.value) {
+        encoder encoder(out);
+        std::visit(encoder, static_cast<const value_t&>(*rep.value));
+        out << "\n";
+    } else {
+        for (const auto& record : rep.heat) {
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+
+            const auto& values = record.values;
+            out << record.uri << " READ " << values.reads << " "
+                << duration_cast<microseconds>(values.read_time).count() << "us WRITE " << values.writes << " "
+                << duration_cast<microseconds>(values.write_time).count() << "us OBSERVE " << values.observes
+                << " EMIT " << values.emits << "\n";
+        }
+
+        // Hand over the result without copying it once more
+        out.flush();
+        outbuf.append(std::move(rep.text));
+    }
+
+    out << prompt;
+}
+
+} // namespace cli
+
+} // namespace decof
@@ -15,34 +15,31 @@
  */
 
 #include "encoder.h"
+#include "timestamp_formatter.h"
 #include <decof/cli/pubsub_context.h>
 #include <decof/exceptions.h>
 #include <decof/object_dictionary.h>
+#include <decof/statistics.h>
 #include <boost/algorithm/string/predicate.hpp>
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/asio.hpp>
-#include <boost/lexical_cast.hpp>
 #include <chrono>
-#include <iomanip>
 #include <limits>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <variant>
 
 using boost::system::error_code;
 
 namespace {
 
-struct iso8601_time
+/// Formats a time point as ISO 8601 UTC timestamp.
+std::string_view iso8601_time(std::chrono::system_clock::time_point time_point)
 {
-    std::chrono::time_point<std::chrono::system_clock> time_point;
-};
-
-std::ostream& operator<<(std::ostream& out, const iso8601_time& arg)
-{
-    std::time_t t = std::chrono::system_clock::to_time_t(arg.time_point);
-    out << std::put_time(std::localtime(&t), "%FT%T.000Z");
-    return out;
+    // Handlers of different connections may run on different threads
+    thread_local decof::cli::timestamp_formatter formatter;
+    return formatter.format(time_point);
 }
 
 } // Anonymous namespace
@@ -52,8 +49,16 @@ namespace decof {
 namespace cli {
 
 pubsub_context::pubsub_context(strand_t& strand, socket_t&& socket, object_dictionary& od, userlevel_t userlevel)
-  : cli_context_base(od, userlevel), strand_(strand), socket_(std::move(socket))
+  : cli_context_base(od, userlevel),
+    dictionary_strand_(strand),
+    strand_(strand.context()),
+    flush_scheduler_(boost::asio::use_service<flush_scheduler>(strand.context())),
+    socket_(std::move(socket))
 {
+    // The endpoint is also reported from the object dictionary strand
+    connection_type_ = transport_name(socket_);
+    remote_endpoint_ = peer_name(socket_);
+
     if (connect_event_cb_)
         connect_event_cb_(true, true, remote_endpoint());
 
@@ -64,13 +69,12 @@ pubsub_context::pubsub_context(strand_t& strand, socket_t&& socket, object_dicti
 
 std::string pubsub_context::connection_type() const
 {
-    return std::string("tcp");
+    return connection_type_;
 }
 
 std::string pubsub_context::remote_endpoint() const
 {
-    error_code ec;
-    return boost::lexical_cast<std::string>(socket_.remote_endpoint(ec));
+    return remote_endpoint_;
 }
 
 void pubsub_context::preload()
@@ -84,12 +88,16 @@ void pubsub_context::preload()
 void pubsub_context::read_handler(const error_code& error, std::size_t bytes_transferred)
 {
     if (!error) {
+        statistics::count_bytes_in(protocol_type::cli, bytes_transferred);
+
         boost::asio::streambuf::const_buffers_type bufs = inbuf_.data();
 
-        process_request(
-            std::string(boost::asio::buffers_begin(bufs), boost::asio::buffers_begin(bufs) + bytes_transferred));
+        std::string request(boost::asio::buffers_begin(bufs), boost::asio::buffers_begin(bufs) + bytes_transferred);
         inbuf_.consume(bytes_transferred);
 
+        auto self = shared_from_this();
+        dictionary_strand_.post([self, request = std::move(request)]() { self->process_request(request); });
+
         preload();
     } else
         close();
@@ -97,6 +105,9 @@ void pubsub_context::read_handler(const error_code& error, std::size_t bytes_tra
 
 void pubsub_context::write_handler(const error_code& error, std::size_t bytes_transferred)
 {
+    outbuf_.consume(bytes_transferred);
+    statistics::count_bytes_out(protocol_type::cli, bytes_transferred);
+
     if (!error) {
         writing_active_ = false;
         preload_writing();
@@ -106,12 +117,18 @@ void pubsub_context::write_handler(const error_code& error, std::size_t bytes_tr
 
 void pubsub_context::notify(std::string uri, const value_t& value)
 {
+    if (suppress_notifications_)
+        return;
+
     // Cut root node name (for compatibility reasons to 'classic' DeCoF)
     if (uri != object_dictionary_.name())
         uri.erase(0, ::strlen(object_dictionary_.name()) + 1);
 
-    pending_updates_.push(uri, value);
-    preload_writing();
+    const auto sequence = object_dictionary_.journal().last_sequence();
+    if (pending_updates_.push(uri, value, sequence)) {
+        auto self = shared_from_this();
+        flush_scheduler_.schedule(strand_, [self]() { self->preload_writing(); });
+    }
 }
 
 void pubsub_context::preload_writing()
@@ -119,25 +136,37 @@ void pubsub_context::preload_writing()
     if (writing_active_)
         return;
 
-    std::ostream out(&outbuf_);
+    output_streambuf sbuf(outbuf_);
+    std::ostream     out(&sbuf);
 
-    while (!pending_updates_.empty() && outbuf_.size() < socket_send_buf_size_) {
-        update_container::key_type   uri;
-        update_container::time_point time;
-        value_t                      value;
-
-        std::tie(uri, value, time) = pending_updates_.pop_front();
+    update_queue::update        update;
+    update_queue::sequence_type sequence = 0;
+    bool                        drained  = false;
+    while (outbuf_.size() < socket_send_buf_size_) {
+        if (!pending_updates_.pop_front(update, sequence)) {
+            drained = true;
+            break;
+        }
 
-        out << "(" << iso8601_time{time} << " '" << uri << " ";
+        const auto& [uri, value, time] = update;
+        out << "(" << iso8601_time(time) << " '" << uri << " ";
         std::visit(encoder(out), value);
-        out << ")\n";
+        out << ")\n" << std::flush;
     }
 
+    // Report the journal sequence number once all updates up to it have been
+    // handed over, so that a client can resume from it after reconnecting.
+    if (report_sequence_ && drained && sequence != reported_sequence_) {
+        out << "(" << iso8601_time(std::chrono::system_clock::now()) << " 'seq " << sequence << ")\n";
+        reported_sequence_ = sequence;
+    }
+
+    out.flush();
     if (outbuf_.size() == 0)
         return;
 
     auto self = shared_from_this();
-    boost::asio::async_write(socket_, outbuf_, strand_.wrap([self](const error_code& err, std::size_t bytes) {
+    boost::asio::async_write(socket_, outbuf_.data(), strand_.wrap([self](const error_code& err, std::size_t bytes) {
         self->write_handler(err, bytes);
     }));
 
@@ -146,8 +175,14 @@ void pubsub_context::preload_writing()
 
 void pubsub_context::close()
 {
-    if (connect_event_cb_)
-        connect_event_cb_(true, false, remote_endpoint());
+    // Callbacks and observations belong to the object dictionary strand
+    auto self = shared_from_this();
+    dictionary_strand_.post([self]() {
+        if (connect_event_cb_)
+            connect_event_cb_(true, false, self->remote_endpoint());
+
+        self->unobserve_all();
+    });
 
     if (!socket_.is_open())
         return;
@@ -182,6 +217,19 @@ void pubsub_context::process_request(std::string request)
             client_context::userlevel(static_cast<userlevel_t>(ul));
             notify(
                 std::string(object_dictionary_.name()) + ":ul", scalar_t(static_cast<decof::integer_t>(userlevel())));
+        } else if (command == "resume") {
+            change_journal::sequence_type sequence;
+            if (!(in >> sequence))
+                throw parse_error();
+
+            // Fall back to a full resync if the journal cannot provide the
+            // changes since the given sequence number.
+            if (object_dictionary_.journal().covers(sequence))
+                resume_sequence_ = sequence;
+            else
+                resume_sequence_.reset();
+
+            notify(std::string(object_dictionary_.name()) + ":resume", resume_sequence_.has_value());
         } else {
             in >> uri;
 
@@ -193,20 +241,41 @@ void pubsub_context::process_request(std::string request)
                 uri.erase(0, 1);
 
             if (command == "subscribe" || command == "add") {
-                if (request_cb_)
-                    request_cb_(request_t::subscribe, request, remote_endpoint());
+                report_request(request_t::subscribe, request);
 
-                // Apply special handling for 'ul' parameter
+                // Apply special handling for 'ul' and 'seq' parameters
                 if (uri == "ul") {
                     notify(std::string(object_dictionary_.name()) + ":ul", static_cast<decof::integer_t>(userlevel()));
+                } else if (uri == "seq") {
+                    const auto sequence = object_dictionary_.journal().last_sequence();
+
+                    auto self = shared_from_this();
+                    strand_.post([self, sequence]() {
+                        self->report_sequence_   = true;
+                        self->reported_sequence_ = sequence;
+                    });
+                    notify(std::string(object_dictionary_.name()) + ":seq", static_cast<integer_t>(sequence));
                 } else {
-                    auto obj = object_dictionary_.find_descendant_object(uri);
-                    observe(
-                        obj, std::bind(&pubsub_context::notify, this, std::placeholders::_1, std::placeholders::_2));
+                    auto        obj     = object_dictionary_.find_descendant_object(uri);
+                    const auto& journal = object_dictionary_.journal();
+
+                    // Skip the initial value if the client already has it
+                    suppress_notifications_ = obj != nullptr && resume_sequence_ &&
+                        journal.covers(*resume_sequence_) && !journal.changed_since(obj->fq_name(), *resume_sequence_);
+
+                    try {
+                        observe(
+                            obj,
+                            std::bind(&pubsub_context::notify, this, std::placeholders::_1, std::placeholders::_2));
+                    } catch (...) {
+                        suppress_notifications_ = false;
+                        throw;
+                    }
+
+                    suppress_notifications_ = false;
                 }
             } else if (command == "unsubscribe" || command == "remove") {
-                if (request_cb_)
-                    request_cb_(request_t::unsubscribe, request, remote_endpoint());
+                report_request(request_t::unsubscribe, request);
 
                 auto obj = object_dictionary_.find_descendant_object(uri);
                 unobserve(obj);
@@ -214,23 +283,32 @@ void pubsub_context::process_request(std::string request)
                 throw unknown_operation_error();
         }
     } catch (invalid_parameter_error& ex) {
-        std::ostream out(&outbuf_);
-        out << "(Error: " << ex.code() << " (" << iso8601_time{std::chrono::system_clock::now()}
+        std::ostringstream out;
+        out << "(Error: " << ex.code() << " (" << iso8601_time(std::chrono::system_clock::now())
             << " 'COMMAND_ERROR) Parameter '" << uri << " not found)\n";
-        preload_writing();
+        send_error(out.str());
     } catch (runtime_error& ex) {
-        std::ostream out(&outbuf_);
-        out << "(Error: " << ex.code() << " (" << iso8601_time{std::chrono::system_clock::now()} << " 'COMMAND_ERROR) "
+        std::ostringstream out;
+        out << "(Error: " << ex.code() << " (" << iso8601_time(std::chrono::system_clock::now()) << " 'COMMAND_ERROR) "
             << ex.what() << "\n";
-        preload_writing();
+        send_error(out.str());
     } catch (...) {
-        std::ostream out(&outbuf_);
-        out << "(Error: " << UNKNOWN_ERROR << " (" << iso8601_time{std::chrono::system_clock::now()}
+        std::ostringstream out;
+        out << "(Error: " << UNKNOWN_ERROR << " (" << iso8601_time(std::chrono::system_clock::now())
             << " 'COMMAND_ERROR) Unknown error\n";
-        preload_writing();
+        send_error(out.str());
     }
 }
 
+void pubsub_context::send_error(std::string message)
+{
+    auto self = shared_from_this();
+    strand_.post([self, message = std::move(message)]() mutable {
+        self->outbuf_.append(std::move(message));
+        self->preload_writing();
+    });
+}
+
 } // namespace cli
 
 } // namespace decof
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "timestamp_formatter.h"
+
+namespace {
+
+/// Writes @a digits decimal digits of @a value right aligned into @a dest.
+void write_digits(char* dest, long value, int digits)
+{
+    for (int i = digits - 1; i >= 0; --i) {
+        dest[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+}
+
+} // Anonymous namespace
+
+namespace decof {
+
+namespace cli {
+
+timestamp_formatter::timestamp_formatter(precision prec) : precision_(prec), cached_second_(0)
+{
+}
+
+std::string_view timestamp_formatter::format(time_point tp)
+{
+    using namespace std::chrono;
+
+    // Split into whole seconds and fraction, rounding towards negative
+    // infinity for time points before the epoch
+    auto       us      = duration_cast<microseconds>(tp.time_since_epoch()).count();
+    auto       seconds = us / 1000000;
+    auto       frac    = us % 1000000;
+    if (frac < 0) {
+        frac += 1000000;
+        seconds -= 1;
+    }
+
+    const auto t = static_cast<std::time_t>(seconds);
+    if (!cache_valid_ || t != cached_second_) {
+        std::tm tm;
+#ifdef _WIN32
+        gmtime_s(&tm, &t);
+#else
+        gmtime_r(&t, &tm);
+#endif
+        write_digits(buffer_, tm.tm_year + 1900, 4);
+        buffer_[4] = '-';
+        write_digits(buffer_ + 5, tm.tm_mon + 1, 2);
+        buffer_[7] = '-';
+        write_digits(buffer_ + 8, tm.tm_mday, 2);
+        buffer_[10] = 'T';
+        write_digits(buffer_ + 11, tm.tm_hour, 2);
+        buffer_[13] = ':';
+        write_digits(buffer_ + 14, tm.tm_min, 2);
+        buffer_[16] = ':';
+        write_digits(buffer_ + 17, tm.tm_sec, 2);
+        buffer_[19] = '.';
+
+        cached_second_ = t;
+        cache_valid_   = true;
+    }
+
+    std::size_t len = prefix_length;
+    if (precision_ == precision::milliseconds) {
+        write_digits(buffer_ + len, static_cast<long>(frac / 1000), 3);
+        len += 3;
+    } else {
+        write_digits(buffer_ + len, static_cast<long>(frac), 6);
+        len += 6;
+    }
+    buffer_[len++] = 'Z';
+
+    return std::string_view(buffer_, len);
+}
+
+} // namespace cli
+
+} // namespace decof
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DECOF_CLI_TIMESTAMP_FORMATTER_H
+#define DECOF_CLI_TIMESTAMP_FORMATTER_H
+
+#include <chrono>
+#include <ctime>
+#include <string_view>
+
+namespace decof {
+
+namespace cli {
+
+/**
+ * @brief Formats time points as ISO 8601 UTC timestamps.
+ *
+ * The date and time up to the second are only formatted when the second
+ * changes. Otherwise just the sub-second digits are filled in, e.g.
+ * @c 2026-10-18T12:34:56.789Z.
+ *
+ * Objects of this class are not thread-safe.
+ */
+class timestamp_formatter
+{
+  public:
+    using time_point = std::chrono::system_clock::time_point;
+
+    enum class precision { milliseconds, microseconds };
+
+    explicit timestamp_formatter(precision prec = precision::milliseconds);
+
+    /**
+     * @brief Format the given time point.
+     *
+     * @return A view on an internal buffer that is valid until the next call.
+     */
+    std::string_view format(time_point tp);
+
+  private:
+    static constexpr std::size_t prefix_length = 20; // "YYYY-MM-DDTHH:MM:SS."
+
+    precision   precision_;
+    std::time_t cached_second_;
+    bool        cache_valid_ = false;
+    char        buffer_[prefix_length + 7];
+};
+
+} // namespace cli
+
+} // namespace decof
+
+#endif // DECOF_CLI_TIMESTAMP_FORMATTER_H
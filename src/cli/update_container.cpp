@@ -81,6 +81,11 @@ bool update_container::empty() const noexcept
     return updates_.empty();
 }
 
+std::size_t update_container::size() const noexcept
+{
+    return updates_.size();
+}
+
 } // namespace cli
 
 } // namespace decof
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <decof/cli/update_queue.h>
+#include <decof/statistics.h>
+
+namespace decof {
+
+namespace cli {
+
+update_queue::~update_queue()
+{
+    statistics::add_backlog(-static_cast<std::int64_t>(updates_.size()));
+}
+
+bool update_queue::push(const key_type& uri, const value_t& value, sequence_type sequence)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (sequence > sequence_)
+        sequence_ = sequence;
+
+    const auto size = updates_.size();
+    updates_.push(uri, value);
+    if (updates_.size() != size)
+        statistics::add_backlog(1);
+
+    if (scheduled_)
+        return false;
+
+    scheduled_ = true;
+    return true;
+}
+
+bool update_queue::pop_front(update& element)
+{
+    sequence_type sequence;
+    return pop_front(element, sequence);
+}
+
+bool update_queue::pop_front(update& element, sequence_type& sequence)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (updates_.empty()) {
+        scheduled_ = false;
+        sequence   = sequence_;
+        return false;
+    }
+
+    element = updates_.pop_front();
+    statistics::add_backlog(-1);
+    return true;
+}
+
+} // namespace cli
+
+} // namespace decof
@@ -15,11 +15,14 @@
  */
 
 #include <decof/client_context/basic_client_context.h>
+#include <decof/client_read_interface.h>
 #include <decof/client_write_interface.h>
 #include <decof/event.h>
 #include <decof/exceptions.h>
 #include <decof/object_dictionary.h>
 #include <decof/userlevel.h>
+#include <algorithm>
+#include <chrono>
 
 namespace decof {
 
@@ -69,7 +72,15 @@ void basic_client_context::set_parameter(object* obj, const value_t& value)
     if (userlevel_ > obj->writelevel())
         throw access_denied_error();
 
+    auto& heat = object_dictionary_.heat();
+    if (!heat.enabled()) {
+        param->generic_value(value);
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
     param->generic_value(value);
+    heat.count(obj, heat_map::access::write, std::chrono::steady_clock::now() - start);
 }
 
 value_t basic_client_context::get_parameter(const object* obj)
@@ -82,7 +93,25 @@ value_t basic_client_context::get_parameter(const object* obj)
     if (effective_userlevel() > obj->readlevel())
         throw access_denied_error();
 
-    return param->generic_value();
+    auto& heat = object_dictionary_.heat();
+    if (!heat.enabled())
+        return param->generic_value();
+
+    const auto start  = std::chrono::steady_clock::now();
+    auto       retval = param->generic_value();
+    heat.count(obj, heat_map::access::read, std::chrono::steady_clock::now() - start);
+    return retval;
+}
+
+std::uint64_t basic_client_context::get_parameter_version(const object* obj)
+{
+    auto param = dynamic_cast<const client_read_interface*>(obj);
+    if (param == nullptr)
+        throw invalid_parameter_error();
+    if (effective_userlevel() > obj->readlevel())
+        throw access_denied_error();
+
+    return param->version();
 }
 
 void basic_client_context::signal_event(object* obj)
@@ -98,7 +127,32 @@ void basic_client_context::signal_event(object* obj)
     if (userlevel_ > obj->writelevel())
         throw access_denied_error();
 
+    auto& heat = object_dictionary_.heat();
+    if (!heat.enabled()) {
+        ev->signal();
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
     ev->signal();
+    heat.count(obj, heat_map::access::write, std::chrono::steady_clock::now() - start);
+}
+
+std::vector<heat_map::record> basic_client_context::heat_report(std::size_t count, heat_map::sort_key key)
+{
+    auto records = object_dictionary_.heat().sorted(key);
+
+    // Skip objects which are gone or which the client must not see
+    auto it = std::remove_if(records.begin(), records.end(), [this](const heat_map::record& record) {
+        auto obj = object_dictionary_.find_object(record.uri);
+        return obj != record.obj || effective_userlevel() > obj->readlevel();
+    });
+    records.erase(it, records.end());
+
+    if (records.size() > count)
+        records.resize(count);
+
+    return records;
 }
 
 void basic_client_context::browse_object(object* obj, object_visitor* visitor)
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "change_journal.h"
+#include <algorithm>
+#include <chrono>
+
+namespace {
+
+decof::change_journal::sequence_type initial_sequence()
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(system_clock::now().time_since_epoch()).count();
+}
+
+} // Anonymous namespace
+
+namespace decof {
+
+change_journal::change_journal(std::size_t capacity) : capacity_(0), last_sequence_(0)
+{
+    this->capacity(capacity);
+}
+
+std::size_t change_journal::capacity() const
+{
+    return capacity_;
+}
+
+void change_journal::capacity(std::size_t capacity)
+{
+    if (capacity_ == 0 && capacity > 0)
+        last_sequence_ = std::max(last_sequence_, initial_sequence());
+
+    capacity_ = capacity;
+
+    while (entries_.size() > capacity_)
+        entries_.pop_front();
+}
+
+bool change_journal::enabled() const
+{
+    return capacity_ > 0;
+}
+
+change_journal::sequence_type change_journal::record(const std::string& uri)
+{
+    if (capacity_ == 0)
+        return 0;
+
+    if (entries_.size() == capacity_)
+        entries_.pop_front();
+
+    entries_.push_back(entry{++last_sequence_, uri});
+    return last_sequence_;
+}
+
+change_journal::sequence_type change_journal::last_sequence() const
+{
+    return last_sequence_;
+}
+
+bool change_journal::covers(sequence_type since) const
+{
+    if (capacity_ == 0 || since > last_sequence_)
+        return false;
+
+    if (since == last_sequence_)
+        return true;
+
+    // The entry directly following 'since' must still be retained
+    return !entries_.empty() && entries_.front().sequence <= since + 1;
+}
+
+bool change_journal::changed_since(std::string_view uri, sequence_type since) const
+{
+    for (auto it = entries_.crbegin(); it != entries_.crend() && it->sequence > since; ++it) {
+        if (it->uri == uri)
+            return true;
+    }
+
+    return false;
+}
+
+} // namespace decof
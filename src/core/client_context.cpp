@@ -18,6 +18,7 @@
 #include <decof/client_write_interface.h>
 #include <decof/event.h>
 #include <decof/exceptions.h>
+#include <decof/node.h>
 #include <decof/object.h>
 #include <decof/object_dictionary.h>
 
@@ -37,6 +38,8 @@ void client_context::observe(object* obj, value_change_slot slot)
     if (effective_userlevel() > obj->readlevel())
         throw access_denied_error();
 
+    object_dictionary_.heat().count(obj, heat_map::access::observe);
+
     auto uri = obj->fq_name();
     if (observables_.count(uri) == 0) {
         observables_[uri] = observable->observe(slot);
@@ -65,6 +68,52 @@ void client_context::unobserve(object* obj)
     observable->unobserve();
 }
 
+void client_context::for_each_observable(object* obj, const std::function<void(object*)>& visitor)
+{
+    if (auto n = dynamic_cast<node*>(obj)) {
+        for (auto child : *n) {
+            if (effective_userlevel() <= child->readlevel())
+                for_each_observable(child, visitor);
+        }
+    } else if (dynamic_cast<client_observe_interface*>(obj) != nullptr)
+        visitor(obj);
+}
+
+void client_context::observe_subtree(object* obj, const value_change_slot& slot)
+{
+    for_each_observable(obj, [this, &slot](object* param) { observe(param, slot); });
+}
+
+void client_context::unobserve_subtree(object* obj)
+{
+    // Observations outlive userlevel changes, so all descendants are visited
+    if (auto n = dynamic_cast<node*>(obj)) {
+        for (auto child : *n)
+            unobserve_subtree(child);
+    } else if (dynamic_cast<client_observe_interface*>(obj) != nullptr) {
+        try {
+            unobserve(obj);
+        } catch (runtime_error&) {
+        }
+    }
+}
+
+void client_context::unobserve_all()
+{
+    while (!observables_.empty()) {
+        const auto uri = observables_.begin()->first;
+        const auto obj = object_dictionary_.find_object(uri);
+
+        try {
+            if (obj != nullptr)
+                unobserve(obj);
+        } catch (runtime_error&) {
+        }
+
+        observables_.erase(uri);
+    }
+}
+
 void client_context::tick()
 {
     object_dictionary_.tick();
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "client_read_interface.h"
+#include <atomic>
+#include <chrono>
+
+namespace decof {
+
+std::uint64_t next_value_version() noexcept
+{
+    using namespace std::chrono;
+
+    static std::atomic<std::uint64_t> version{static_cast<std::uint64_t>(
+        duration_cast<microseconds>(system_clock::now().time_since_epoch()).count())};
+
+    return version.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+} // namespace decof
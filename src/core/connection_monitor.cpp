@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <decof/client_context/connection_monitor.h>
+#include <algorithm>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+/// Returns for how long no data was sent or received or -1 if unknown.
+std::chrono::milliseconds idle_time(int fd)
+{
+#ifdef TCP_INFO
+    tcp_info  info;
+    socklen_t len = sizeof(info);
+    if (::getsockopt(fd, IPPROTO_TCP, TCP_INFO, &info, &len) == 0)
+        return std::chrono::milliseconds(std::min(info.tcpi_last_data_recv, info.tcpi_last_data_sent));
+#endif
+
+    return std::chrono::milliseconds(-1);
+}
+
+} // Anonymous namespace
+
+namespace decof {
+
+connection_monitor::~connection_monitor()
+{
+    for (const auto& [id, fd] : descriptors_) {
+        if (fd >= 0)
+            ::close(fd);
+    }
+}
+
+connection_monitor::id_type connection_monitor::add(int native_handle, bool track_idle)
+{
+    const int fd = track_idle ? ::dup(native_handle) : -1;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    descriptors_.emplace(next_id_, fd);
+    return next_id_++;
+}
+
+void connection_monitor::remove(id_type id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = descriptors_.find(id);
+    if (it == descriptors_.end())
+        return;
+
+    if (it->second >= 0)
+        ::close(it->second);
+    descriptors_.erase(it);
+}
+
+std::size_t connection_monitor::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return descriptors_.size();
+}
+
+std::size_t connection_monitor::reap(std::chrono::milliseconds timeout)
+{
+    std::size_t                 retval = 0;
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (auto& [id, fd] : descriptors_) {
+        if (fd < 0)
+            continue;
+
+        const auto idle = idle_time(fd);
+        if (idle < timeout)
+            continue;
+
+        // The connection is counted until its context is gone
+        ::shutdown(fd, SHUT_RDWR);
+        ::close(fd);
+        fd = -1;
+        ++retval;
+    }
+
+    return retval;
+}
+
+} // namespace decof
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <decof/client_context/flush_scheduler.h>
+
+namespace decof {
+
+boost::asio::io_service::id flush_scheduler::id;
+
+flush_scheduler::flush_scheduler(boost::asio::io_service& io_service)
+  : boost::asio::io_service::service(io_service), timer_(io_service)
+{
+}
+
+std::chrono::microseconds flush_scheduler::interval() const
+{
+    return std::chrono::microseconds(interval_.load(std::memory_order_relaxed));
+}
+
+void flush_scheduler::interval(std::chrono::microseconds interval)
+{
+    interval_.store(interval.count(), std::memory_order_relaxed);
+}
+
+void flush_scheduler::schedule(strand_t& strand, std::function<void()> flush)
+{
+    const auto interval = this->interval();
+    if (interval.count() == 0) {
+        strand.post(std::move(flush));
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.emplace_back(&strand, std::move(flush));
+
+    if (!armed_) {
+        armed_ = true;
+        timer_.expires_after(interval);
+        timer_.async_wait([this](const boost::system::error_code& error) { expired(error); });
+    }
+}
+
+std::size_t flush_scheduler::batches() const
+{
+    return batches_.load(std::memory_order_relaxed);
+}
+
+void flush_scheduler::shutdown()
+{
+    // Flush functions keep their contexts alive
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.clear();
+}
+
+void flush_scheduler::expired(const boost::system::error_code& error)
+{
+    if (error)
+        return;
+
+    decltype(pending_) flushes;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        flushes.swap(pending_);
+        armed_ = false;
+    }
+
+    for (auto& [strand, flush] : flushes)
+        strand->post(std::move(flush));
+
+    ++batches_;
+}
+
+} // namespace decof
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "heat_map.h"
+#include "object.h"
+#include <algorithm>
+
+namespace decof {
+
+std::uint64_t heat_map::counters::count() const noexcept
+{
+    return reads + writes + observes + emits;
+}
+
+heat_map::duration heat_map::counters::time() const noexcept
+{
+    return read_time + write_time;
+}
+
+bool heat_map::enabled() const noexcept
+{
+    return enabled_;
+}
+
+void heat_map::enabled(bool enabled) noexcept
+{
+    enabled_ = enabled;
+}
+
+void heat_map::count(const object* obj, access type, duration time)
+{
+    if (!enabled_ || obj == nullptr)
+        return;
+
+    auto it = entries_.find(obj);
+    if (it == entries_.end())
+        it = entries_.emplace(obj, entry{obj->fq_name(), counters()}).first;
+
+    auto& values = it->second.values;
+    switch (type) {
+    case access::read:
+        ++values.reads;
+        values.read_time += time;
+        break;
+    case access::write:
+        ++values.writes;
+        values.write_time += time;
+        break;
+    case access::observe:
+        ++values.observes;
+        break;
+    case access::emit:
+        ++values.emits;
+        break;
+    }
+}
+
+std::vector<heat_map::record> heat_map::sorted(sort_key key) const
+{
+    std::vector<record> retval;
+    retval.reserve(entries_.size());
+    for (const auto& [obj, entry] : entries_)
+        retval.push_back(record{obj, entry.uri, entry.values});
+
+    std::sort(retval.begin(), retval.end(), [key](const record& lhs, const record& rhs) {
+        if (key == sort_key::time && lhs.values.time() != rhs.values.time())
+            return lhs.values.time() > rhs.values.time();
+        if (lhs.values.count() != rhs.values.count())
+            return lhs.values.count() > rhs.values.count();
+        return lhs.uri < rhs.uri;
+    });
+
+    return retval;
+}
+
+void heat_map::clear()
+{
+    entries_.clear();
+}
+
+} // namespace decof
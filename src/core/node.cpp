@@ -24,6 +24,8 @@
 
 namespace decof {
 
+std::atomic<std::uint64_t> node::generation_{0};
+
 node::node(const char* name, node* parent, userlevel_t readlevel)
   : readable_parameter<std::list<const char*>>(name, parent, readlevel, Forbidden)
 {
@@ -34,6 +36,9 @@ node::~node()
     for (auto child : children_) {
         child->parent_ = nullptr;
     }
+
+    if (!children_.empty())
+        ++generation_;
 }
 
 std::list<const char*> node::value() const
@@ -53,6 +58,7 @@ void node::add_child(object* child)
 
     children_.push_back(child);
     child->parent_ = this;
+    ++generation_;
 }
 
 void node::remove_child(object* child)
@@ -64,6 +70,7 @@ void node::remove_child(object* child)
         }
         return false;
     });
+    ++generation_;
 }
 
 object* node::find_child(std::string_view name)
@@ -121,4 +128,9 @@ node::iterator node::end()
     return children_.end();
 }
 
+std::uint64_t node::generation() noexcept
+{
+    return generation_;
+}
+
 } // namespace decof
@@ -54,6 +54,11 @@ void object_dictionary::unregister_for_tick(tick_interface* tick_target)
     tick_targets_.remove(tick_target);
 }
 
+std::size_t object_dictionary::tick_target_count() const
+{
+    return tick_targets_.size();
+}
+
 object* object_dictionary::find_object(std::string_view uri, char separator)
 {
     if (uri.empty()) {
@@ -79,6 +84,26 @@ object* object_dictionary::find_object(std::string_view uri, char separator)
     return find_descendant_object(uri, separator);
 }
 
+change_journal& object_dictionary::journal()
+{
+    return journal_;
+}
+
+const change_journal& object_dictionary::journal() const
+{
+    return journal_;
+}
+
+heat_map& object_dictionary::heat()
+{
+    return heat_;
+}
+
+const heat_map& object_dictionary::heat() const
+{
+    return heat_;
+}
+
 void object_dictionary::set_current_context(basic_client_context* client_context)
 {
     current_context_ = client_context;
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <decof/client_context/output_buffer.h>
+#include <algorithm>
+
+namespace {
+
+/// Initial capacity of segments holding copied data.
+const std::size_t chunk_size = 1024;
+
+} // Anonymous namespace
+
+namespace decof {
+
+std::string_view output_buffer::segment::view() const
+{
+    if (shared)
+        return *shared;
+    if (referenced.data() != nullptr)
+        return referenced;
+    return owned;
+}
+
+void output_buffer::append(std::string_view data)
+{
+    if (data.empty())
+        return;
+
+    if (segments_.empty() || !segments_.back().growable) {
+        segments_.emplace_back();
+        segments_.back().growable = true;
+        segments_.back().owned.reserve(std::max(chunk_size, data.size()));
+    }
+
+    segments_.back().owned.append(data.data(), data.size());
+    size_ += data.size();
+    bytes_copied_ += data.size();
+}
+
+void output_buffer::append(std::string&& data)
+{
+    if (data.empty())
+        return;
+
+    size_ += data.size();
+    bytes_referenced_ += data.size();
+
+    segments_.emplace_back();
+    segments_.back().owned = std::move(data);
+}
+
+void output_buffer::append(std::shared_ptr<const std::string> data)
+{
+    if (!data || data->empty())
+        return;
+
+    size_ += data->size();
+    bytes_referenced_ += data->size();
+
+    segments_.emplace_back();
+    segments_.back().shared = std::move(data);
+}
+
+void output_buffer::append_static(std::string_view data)
+{
+    if (data.empty())
+        return;
+
+    size_ += data.size();
+    bytes_referenced_ += data.size();
+
+    segments_.emplace_back();
+    segments_.back().referenced = data;
+}
+
+std::size_t output_buffer::size() const
+{
+    return size_;
+}
+
+bool output_buffer::empty() const
+{
+    return size_ == 0;
+}
+
+output_buffer::const_buffers_type output_buffer::data()
+{
+    const_buffers_type retval;
+    retval.reserve(segments_.size());
+
+    std::size_t offset = offset_;
+    for (auto& seg : segments_) {
+        // The buffer sequence must stay valid during asynchronous writes
+        seg.growable = false;
+
+        auto view = seg.view();
+        retval.emplace_back(view.data() + offset, view.size() - offset);
+        offset = 0;
+    }
+
+    return retval;
+}
+
+void output_buffer::consume(std::size_t n)
+{
+    n = std::min(n, size_);
+    size_ -= n;
+
+    while (n > 0) {
+        const auto remaining = segments_.front().view().size() - offset_;
+        if (n < remaining) {
+            offset_ += n;
+            return;
+        }
+
+        n -= remaining;
+        offset_ = 0;
+        segments_.pop_front();
+    }
+}
+
+std::size_t output_buffer::bytes_copied() const
+{
+    return bytes_copied_;
+}
+
+std::size_t output_buffer::bytes_referenced() const
+{
+    return bytes_referenced_;
+}
+
+void output_buffer::reset_counters()
+{
+    bytes_copied_     = 0;
+    bytes_referenced_ = 0;
+}
+
+output_streambuf::output_streambuf(output_buffer& buf) : buf_(buf)
+{
+    setp(local_, local_ + sizeof(local_));
+}
+
+output_streambuf::~output_streambuf()
+{
+    sync();
+}
+
+output_streambuf::int_type output_streambuf::overflow(int_type ch)
+{
+    sync();
+
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+    }
+
+    return traits_type::not_eof(ch);
+}
+
+std::streamsize output_streambuf::xsputn(const char_type* s, std::streamsize count)
+{
+    // Append larger chunks directly instead of going through the local buffer
+    if (count > epptr() - pptr()) {
+        sync();
+        buf_.append(std::string_view(s, static_cast<std::size_t>(count)));
+        return count;
+    }
+
+    traits_type::copy(pptr(), s, static_cast<std::size_t>(count));
+    pbump(static_cast<int>(count));
+    return count;
+}
+
+int output_streambuf::sync()
+{
+    buf_.append(std::string_view(pbase(), static_cast<std::size_t>(pptr() - pbase())));
+    setp(local_, local_ + sizeof(local_));
+    return 0;
+}
+
+} // namespace decof
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "statistics.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace decof {
+
+namespace statistics {
+
+namespace {
+
+/// Counters of a thread. Only the owning thread modifies them.
+struct counters
+{
+    std::array<std::atomic<std::uint64_t>, request_types>   requests{};
+    std::array<std::atomic<std::uint64_t>, latency_buckets> latencies{};
+    std::array<std::atomic<std::uint64_t>, protocols>       bytes_in{};
+    std::array<std::atomic<std::uint64_t>, protocols>       bytes_out{};
+
+    std::atomic<std::int64_t> connections{0};
+    std::atomic<std::int64_t> backlog{0};
+
+    std::atomic<std::uint64_t> ticks{0};
+    std::atomic<std::uint64_t> tick_time{0};
+    std::atomic<std::uint64_t> tick_overruns{0};
+};
+
+/// Adds to a counter of the own thread without a read-modify-write operation.
+template <typename T>
+void add(std::atomic<T>& counter, T value) noexcept
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+template <typename T, std::size_t N>
+void accumulate(std::array<T, N>& sum, const std::array<std::atomic<T>, N>& counters)
+{
+    for (std::size_t i = 0; i < N; ++i)
+        sum[i] += counters[i].load(std::memory_order_relaxed);
+}
+
+void accumulate(snapshot& sum, const counters& c)
+{
+    accumulate(sum.requests, c.requests);
+    accumulate(sum.latencies, c.latencies);
+    accumulate(sum.bytes_in, c.bytes_in);
+    accumulate(sum.bytes_out, c.bytes_out);
+
+    sum.connections += c.connections.load(std::memory_order_relaxed);
+    sum.backlog += c.backlog.load(std::memory_order_relaxed);
+    sum.ticks += c.ticks.load(std::memory_order_relaxed);
+    sum.tick_time += c.tick_time.load(std::memory_order_relaxed);
+    sum.tick_overruns += c.tick_overruns.load(std::memory_order_relaxed);
+}
+
+/// Counters of all threads plus the sums of the exited threads.
+struct registry
+{
+    std::mutex             mutex;
+    std::vector<counters*> threads;
+    snapshot               retired;
+};
+
+registry& global_registry()
+{
+    static registry instance;
+    return instance;
+}
+
+/// Registers the counters of a thread for its lifetime.
+struct thread_counters
+{
+    thread_counters()
+    {
+        auto&                       reg = global_registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        reg.threads.push_back(&values);
+    }
+
+    ~thread_counters()
+    {
+        auto&                       reg = global_registry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        accumulate(reg.retired, values);
+        reg.threads.erase(std::find(reg.threads.begin(), reg.threads.end(), &values));
+    }
+
+    counters values;
+};
+
+/// Fast access to the counters of a thread without the initialization check
+/// of a thread_local object with a constructor.
+thread_local counters* local_counters_ = nullptr;
+
+counters& register_thread()
+{
+    thread_local thread_counters instance;
+    local_counters_ = &instance.values;
+    return instance.values;
+}
+
+counters& local_counters()
+{
+    return local_counters_ != nullptr ? *local_counters_ : register_thread();
+}
+
+std::size_t latency_bucket(std::chrono::steady_clock::duration latency)
+{
+    auto        us     = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    std::size_t bucket = 0;
+    while (us > 0 && bucket + 1 < latency_buckets) {
+        us >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+} // Anonymous namespace
+
+void count_request(request_type type) noexcept
+{
+    add(local_counters().requests[static_cast<std::size_t>(type)], std::uint64_t{1});
+}
+
+void record_latency(std::chrono::steady_clock::duration latency) noexcept
+{
+    add(local_counters().latencies[latency_bucket(latency)], std::uint64_t{1});
+}
+
+void count_bytes_in(protocol_type protocol, std::size_t bytes) noexcept
+{
+    add(local_counters().bytes_in[static_cast<std::size_t>(protocol)], static_cast<std::uint64_t>(bytes));
+}
+
+void count_bytes_out(protocol_type protocol, std::size_t bytes) noexcept
+{
+    add(local_counters().bytes_out[static_cast<std::size_t>(protocol)], static_cast<std::uint64_t>(bytes));
+}
+
+void add_connections(std::int64_t delta) noexcept
+{
+    add(local_counters().connections, delta);
+}
+
+void add_backlog(std::int64_t delta) noexcept
+{
+    add(local_counters().backlog, delta);
+}
+
+void record_tick(std::chrono::steady_clock::duration duration, bool overrun) noexcept
+{
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+
+    auto& c = local_counters();
+    add(c.ticks, std::uint64_t{1});
+    add(c.tick_time, static_cast<std::uint64_t>(ns));
+    if (overrun)
+        add(c.tick_overruns, std::uint64_t{1});
+}
+
+snapshot collect()
+{
+    auto&                       reg = global_registry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+
+    snapshot retval = reg.retired;
+    for (auto c : reg.threads)
+        accumulate(retval, *c);
+
+    return retval;
+}
+
+double latency_percentile(const std::array<std::uint64_t, latency_buckets>& latencies, double percentile)
+{
+    std::uint64_t total = 0;
+    for (auto count : latencies)
+        total += count;
+
+    if (total == 0)
+        return 0.0;
+
+    const double  rank       = percentile * static_cast<double>(total);
+    std::uint64_t cumulative = 0;
+    for (std::size_t i = 0; i < latency_buckets; ++i) {
+        if (latencies[i] == 0 || static_cast<double>(cumulative + latencies[i]) < rank) {
+            cumulative += latencies[i];
+            continue;
+        }
+
+        const double lower = i == 0 ? 0.0 : static_cast<double>(1ull << (i - 1));
+        const double upper = static_cast<double>(1ull << i);
+        return lower + (upper - lower) * (rank - static_cast<double>(cumulative)) / static_cast<double>(latencies[i]);
+    }
+
+    return static_cast<double>(1ull << (latency_buckets - 1));
+}
+
+} // namespace statistics
+
+} // namespace decof
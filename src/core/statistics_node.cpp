@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "statistics_node.h"
+#include "external_readonly_handler_parameter.h"
+#include "object_dictionary.h"
+#include <array>
+
+namespace decof {
+
+namespace {
+
+const std::array<const char*, statistics::request_types> request_names = {
+    "get", "set", "signal", "browse", "tree", "subscribe", "unsubscribe"};
+
+const std::array<const char*, statistics::protocols> protocol_names = {"cli", "binary", "scgi"};
+
+} // Anonymous namespace
+
+statistics_node::statistics_node(
+    const char* name, node* parent, std::chrono::steady_clock::duration window, userlevel_t readlevel)
+  : node(name, parent, readlevel),
+    window_(window),
+    readlevel_(readlevel),
+    previous_time_(std::chrono::steady_clock::now()),
+    current_time_(previous_time_),
+    previous_(statistics::collect()),
+    current_(previous_),
+    requests_per_second_("requests-per-second", this, readlevel),
+    request_latency_("request-latency", this, readlevel),
+    bytes_in_("bytes-in", this, readlevel),
+    bytes_out_("bytes-out", this, readlevel)
+{
+    for (std::size_t i = 0; i < statistics::request_types; ++i) {
+        add_real(request_names[i], &requests_per_second_, [this, i]() {
+            return static_cast<real_t>(current_.requests[i] - previous_.requests[i]) / window_seconds();
+        });
+    }
+
+    const std::array<std::pair<const char*, double>, 3> percentiles = {{{"p50", 0.5}, {"p90", 0.9}, {"p99", 0.99}}};
+    for (const auto& [percentile_name, percentile] : percentiles) {
+        add_real(percentile_name, &request_latency_, [this, percentile = percentile]() {
+            std::array<std::uint64_t, statistics::latency_buckets> latencies;
+            for (std::size_t i = 0; i < statistics::latency_buckets; ++i)
+                latencies[i] = current_.latencies[i] - previous_.latencies[i];
+            return statistics::latency_percentile(latencies, percentile);
+        });
+    }
+
+    for (std::size_t i = 0; i < statistics::protocols; ++i) {
+        add_integer(protocol_names[i], &bytes_in_, [this, i]() { return current_.bytes_in[i]; });
+        add_integer(protocol_names[i], &bytes_out_, [this, i]() { return current_.bytes_out[i]; });
+    }
+
+    add_integer("connections", this, [this]() { return current_.connections; });
+    add_integer("update-backlog", this, [this]() { return current_.backlog; });
+
+    add_real("tick-duration", this, [this]() {
+        const auto ticks = current_.ticks - previous_.ticks;
+        if (ticks == 0)
+            return 0.0;
+        return static_cast<real_t>(current_.tick_time - previous_.tick_time) / 1000.0 / static_cast<real_t>(ticks);
+    });
+
+    add_integer("tick-overruns", this, [this]() { return current_.tick_overruns; });
+
+    add_integer("tick-targets", this, [this]() {
+        auto od = get_object_dictionary();
+        return od != nullptr ? od->tick_target_count() : 0;
+    });
+}
+
+statistics_node::~statistics_node()
+{
+}
+
+void statistics_node::sample()
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (now - current_time_ < window_)
+        return;
+
+    previous_      = current_;
+    previous_time_ = current_time_;
+    current_       = statistics::collect();
+    current_time_  = now;
+}
+
+double statistics_node::window_seconds() const
+{
+    const auto seconds = std::chrono::duration<double>(current_time_ - previous_time_).count();
+    return seconds > 0.0 ? seconds : 1.0;
+}
+
+template <typename F>
+void statistics_node::add_real(const char* name, node* parent, F f)
+{
+    auto param = std::make_unique<external_readonly_handler_parameter<real_t>>(name, parent, readlevel_);
+    param->external_value_handler([this, f]() {
+        sample();
+        return static_cast<real_t>(f());
+    });
+    parameters_.push_back(std::move(param));
+}
+
+template <typename F>
+void statistics_node::add_integer(const char* name, node* parent, F f)
+{
+    auto param = std::make_unique<external_readonly_handler_parameter<integer_t>>(name, parent, readlevel_);
+    param->external_value_handler([this, f]() {
+        sample();
+        return static_cast<integer_t>(f());
+    });
+    parameters_.push_back(std::move(param));
+}
+
+} // namespace decof
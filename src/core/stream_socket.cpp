@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <decof/client_context/stream_socket.h>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/lexical_cast.hpp>
+#include <cstring>
+#include <sys/socket.h>
+
+using boost::system::error_code;
+
+namespace decof {
+
+std::string transport_name(const stream_socket& socket)
+{
+    error_code ec;
+    const auto family = socket.local_endpoint(ec).protocol().family();
+
+    if (family == AF_UNIX)
+        return std::string("unix");
+    return std::string("tcp");
+}
+
+std::string peer_name(const stream_socket& socket)
+{
+    error_code ec;
+    const auto endpoint = socket.remote_endpoint(ec);
+    if (ec)
+        return std::string();
+
+    if (endpoint.protocol().family() != AF_UNIX) {
+        boost::asio::ip::tcp::endpoint tcp_endpoint;
+        std::memcpy(tcp_endpoint.data(), endpoint.data(), endpoint.size());
+        return boost::lexical_cast<std::string>(tcp_endpoint);
+    }
+
+#ifdef SO_PEERCRED
+    // Unix domain peers are usually unnamed, but the kernel knows who they are
+    ucred     cred;
+    socklen_t len = sizeof(cred);
+    auto      fd  = const_cast<stream_socket&>(socket).native_handle();
+    if (::getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) == 0) {
+        return "unix:pid=" + std::to_string(cred.pid) + ",uid=" + std::to_string(cred.uid) +
+            ",gid=" + std::to_string(cred.gid);
+    }
+#endif
+
+    return std::string("unix");
+}
+
+} // namespace decof
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <decof/coroutine/clisrv_context.h>
+#include <decof/statistics.h>
+#include <boost/asio/buffers_iterator.hpp>
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/system/system_error.hpp>
+#include <chrono>
+#include <string>
+
+using boost::system::error_code;
+
+namespace {
+
+/// Refers to a buffer sequence instead of copying it into each operation.
+struct buffers_ref
+{
+    const decof::output_buffer::const_buffers_type& buffers;
+
+    auto begin() const
+    {
+        return buffers.begin();
+    }
+
+    auto end() const
+    {
+        return buffers.end();
+    }
+};
+
+} // Anonymous namespace
+
+namespace decof {
+
+namespace coroutine {
+
+clisrv_context::clisrv_context(strand_t& strand, socket_t&& socket, object_dictionary& od, userlevel_t userlevel)
+  : clisrv_context_base(od, userlevel), context_base(strand), socket_(std::move(socket))
+{
+    // The endpoint is also reported from the object dictionary strand
+    connection_type_ = transport_name(socket_);
+    remote_endpoint_ = peer_name(socket_);
+
+    if (connect_event_cb_)
+        connect_event_cb_(false, true, remote_endpoint());
+}
+
+std::string clisrv_context::connection_type() const
+{
+    return connection_type_;
+}
+
+std::string clisrv_context::remote_endpoint() const
+{
+    return remote_endpoint_;
+}
+
+void clisrv_context::preload()
+{
+    // The function object and thus the context is kept alive by the coroutine
+    auto self = shared_from_this();
+    boost::asio::co_spawn(strand_, [self]() { return self->run(); }, boost::asio::detached);
+}
+
+clisrv_context::awaitable<void> clisrv_context::run()
+{
+    append_greeting(outbuf_);
+
+    try {
+        for (;;) {
+            const auto buffers = outbuf_.data();
+            const auto written = co_await boost::asio::async_write(socket_, buffers_ref{buffers}, use_awaitable);
+            outbuf_.consume(written);
+            statistics::count_bytes_out(protocol_type::cli, written);
+
+            const auto length   = co_await boost::asio::async_read_until(socket_, inbuf_, '\n', use_awaitable);
+            const auto received = std::chrono::steady_clock::now();
+            statistics::count_bytes_in(protocol_type::cli, length);
+
+            // Reuses the capacity of the previous request
+            auto bufs = inbuf_.data();
+            request_.assign(boost::asio::buffers_begin(bufs), boost::asio::buffers_begin(bufs) + length);
+            inbuf_.consume(length);
+
+            // Only the evaluation is serialized with the other connections
+            request req;
+            reply   rep;
+            if (parse_request(request_, req, rep))
+                co_await on_dictionary_strand([this, &req, &rep]() { evaluate_request(req, rep); });
+
+            encode_reply(std::move(rep), outbuf_);
+            statistics::record_latency(std::chrono::steady_clock::now() - received);
+        }
+    } catch (const boost::system::system_error&) {
+        // The peer disconnected or the connection broke down
+    }
+
+    if (connect_event_cb_)
+        co_await on_dictionary_strand([this]() { connect_event_cb_(false, false, remote_endpoint()); });
+
+    error_code ec;
+    socket_.shutdown(socket_t::shutdown_both, ec);
+    socket_.close(ec);
+}
+
+} // namespace coroutine
+
+} // namespace decof
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "batch.h"
+#include <algorithm>
+
+namespace {
+
+int hex_digit_value(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+/// Decodes a percent-encoded query string component.
+std::string percent_decode(std::string_view str)
+{
+    std::string retval;
+    retval.reserve(str.size());
+
+    for (std::size_t i = 0; i < str.size(); ++i) {
+        if (str[i] == '+') {
+            retval += ' ';
+        } else if (str[i] == '%' && i + 2 < str.size() && hex_digit_value(str[i + 1]) >= 0 &&
+                   hex_digit_value(str[i + 2]) >= 0) {
+            retval += static_cast<char>(hex_digit_value(str[i + 1]) * 16 + hex_digit_value(str[i + 2]));
+            i += 2;
+        } else {
+            retval += str[i];
+        }
+    }
+
+    return retval;
+}
+
+} // Anonymous namespace
+
+namespace decof {
+
+namespace scgi {
+
+std::vector<std::string> batch_uris_from_query(std::string_view query)
+{
+    std::vector<std::string> retval;
+
+    while (!query.empty()) {
+        auto amp_idx = query.find('&');
+        auto param   = query.substr(0, amp_idx);
+        query.remove_prefix(std::min(amp_idx, query.size() - 1) + 1);
+
+        auto eq_idx = param.find('=');
+        if (eq_idx != std::string_view::npos && param.substr(0, eq_idx) == "uri")
+            retval.push_back(percent_decode(param.substr(eq_idx + 1)));
+    }
+
+    return retval;
+}
+
+std::vector<std::string> batch_uris_from_body(std::string_view body)
+{
+    std::vector<std::string> retval;
+
+    while (!body.empty()) {
+        auto nl_idx = body.find('\n');
+        auto line   = body.substr(0, nl_idx);
+        body.remove_prefix(std::min(nl_idx, body.size() - 1) + 1);
+
+        auto first = line.find_first_not_of(" \t\r");
+        if (first != std::string_view::npos)
+            retval.emplace_back(line.substr(first, line.find_last_not_of(" \t\r") - first + 1));
+    }
+
+    return retval;
+}
+
+std::string encode_multipart(const std::vector<batch_item>& items, std::string& boundary)
+{
+    // Choose a boundary that does not occur in any (binary) body
+    for (unsigned n = 0;; ++n) {
+        boundary = "decof-batch-" + std::to_string(n);
+        if (std::none_of(items.cbegin(), items.cend(), [&boundary](const batch_item& item) {
+                return item.body.find(boundary) != std::string::npos;
+            }))
+            break;
+    }
+
+    std::size_t size = 0;
+    for (const auto& item : items)
+        size += item.uri.size() + item.etag.size() + item.body.size() + 2 * boundary.size() + 128;
+
+    std::string retval;
+    retval.reserve(size);
+
+    for (const auto& item : items) {
+        response status_resp = response::stock_response(item.status);
+
+        retval += "--";
+        retval += boundary;
+        retval += "\r\nContent-Location: ";
+        retval += item.uri;
+        retval += "\r\nStatus: ";
+        retval += std::to_string(static_cast<int>(item.status));
+        retval += " ";
+        retval += status_resp.status_text();
+        retval += "\r\n";
+        if (!item.etag.empty()) {
+            retval += "ETag: ";
+            retval += item.etag;
+            retval += "\r\n";
+        }
+        retval += "Content-Type: text/plain\r\nContent-Length: ";
+        retval += std::to_string(item.body.size());
+        retval += "\r\n\r\n";
+        retval += item.body;
+        retval += "\r\n";
+    }
+
+    retval += "--";
+    retval += boundary;
+    retval += "--\r\n";
+    return retval;
+}
+
+} // namespace scgi
+
+} // namespace decof
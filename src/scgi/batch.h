@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DECOF_SCGI_BATCH_H
+#define DECOF_SCGI_BATCH_H
+
+#include <decof/scgi/response.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace decof {
+
+namespace scgi {
+
+/// Result of a single parameter read within a batch request.
+struct batch_item
+{
+    std::string           uri;
+    response::status_code status = response::status_code::ok;
+    std::string           etag;
+    std::string           body;
+};
+
+/**
+ * @brief Extracts the URIs of a batch request query string.
+ *
+ * The query string has the form @c uri=a&uri=b. Other query parameters are
+ * ignored.
+ */
+std::vector<std::string> batch_uris_from_query(std::string_view query);
+
+/// Extracts the URIs of a batch request body with one URI per line.
+std::vector<std::string> batch_uris_from_body(std::string_view body);
+
+/**
+ * @brief Encodes batch items as multipart/mixed document.
+ *
+ * Each part carries the item URI as @c Content-Location header, its status
+ * as CGI style @c Status header, and an @c ETag header if available.
+ *
+ * @param items The items in request order.
+ * @param boundary Receives the boundary delimiting the parts.
+ * @return The document.
+ */
+std::string encode_multipart(const std::vector<batch_item>& items, std::string& boundary);
+
+} // namespace scgi
+
+} // namespace decof
+
+#endif // DECOF_SCGI_BATCH_H
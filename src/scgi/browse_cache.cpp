@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "browse_cache.h"
+#include "etag.h"
+#include <decof/node.h>
+
+namespace decof {
+
+namespace scgi {
+
+browse_cache::entry
+browse_cache::get(const object_dictionary* od, userlevel_t userlevel, const generator_type& generate)
+{
+    const auto generation = node::generation();
+    const auto key        = std::make_pair(od, userlevel);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto                        it = entries_.find(key);
+        if (it != entries_.end() && it->second.content && it->second.generation == generation)
+            return it->second;
+    }
+
+    // Generate outside the lock; the generation has been taken before, so a
+    // concurrent tree change results in regeneration on the next request.
+    entry result;
+    result.generation = generation;
+    result.content    = std::make_shared<const std::string>(generate());
+    result.etag       = make_etag(*result.content);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_[key] = result;
+    return result;
+}
+
+} // namespace scgi
+
+} // namespace decof
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DECOF_SCGI_BROWSE_CACHE_H
+#define DECOF_SCGI_BROWSE_CACHE_H
+
+#include <decof/userlevel.h>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace decof {
+
+class object_dictionary;
+
+namespace scgi {
+
+/**
+ * @brief Cache of generated object tree descriptions.
+ *
+ * Descriptions are cached per object dictionary and effective userlevel and
+ * are regenerated once the tree structure generation (see
+ * node::generation()) has changed. The cache may be used concurrently.
+ */
+class browse_cache
+{
+  public:
+    struct entry
+    {
+        std::uint64_t                      generation = 0;
+        std::shared_ptr<const std::string> content;
+        std::string                        etag;
+    };
+
+    using generator_type = std::function<std::string()>;
+
+    /**
+     * @brief Returns the cached description or generates it.
+     *
+     * @param od The object dictionary described.
+     * @param userlevel The effective userlevel of the description.
+     * @param generate Function generating the description if required.
+     */
+    entry get(const object_dictionary* od, userlevel_t userlevel, const generator_type& generate);
+
+  private:
+    std::mutex                                                        mutex_;
+    std::map<std::pair<const object_dictionary*, userlevel_t>, entry> entries_;
+};
+
+} // namespace scgi
+
+} // namespace decof
+
+#endif // DECOF_SCGI_BROWSE_CACHE_H
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "byte_range.h"
+#include "js_value_encoder.h"
+#include <charconv>
+#include <sstream>
+#include <variant>
+
+namespace {
+
+using namespace decof;
+
+/// Returns the encoded size of elements of fixed size or zero.
+std::size_t fixed_element_size(const sequence_t& seq)
+{
+    if (seq.empty())
+        return 1;
+    if (std::holds_alternative<boolean_t>(seq.front()))
+        return 1;
+    if (std::holds_alternative<integer_t>(seq.front()))
+        return 4;
+    if (std::holds_alternative<real_t>(seq.front()))
+        return 8;
+    return 0;
+}
+
+std::string encode(const value_t& value)
+{
+    std::ostringstream out;
+    std::visit(scgi::js_value_encoder(out), value);
+    return out.str();
+}
+
+bool parse_position(std::string_view str, std::size_t& value)
+{
+    if (str.empty())
+        return false;
+
+    auto result = std::from_chars(str.data(), str.data() + str.size(), value);
+    return result.ec == std::errc() && result.ptr == str.data() + str.size();
+}
+
+} // Anonymous namespace
+
+namespace decof {
+
+namespace scgi {
+
+range_result parse_range(std::string_view header_value, std::size_t length, byte_range& range)
+{
+    const std::string_view unit = "bytes=";
+    if (header_value.substr(0, unit.size()) != unit)
+        return range_result::ignore;
+
+    auto spec = header_value.substr(unit.size());
+    if (spec.find(',') != std::string_view::npos)
+        return range_result::ignore;
+
+    auto dash_idx = spec.find('-');
+    if (dash_idx == std::string_view::npos)
+        return range_result::ignore;
+
+    auto        first_str = spec.substr(0, dash_idx);
+    auto        last_str  = spec.substr(dash_idx + 1);
+    std::size_t first, last;
+
+    if (first_str.empty()) {
+        // Suffix range
+        std::size_t suffix_length;
+        if (!parse_position(last_str, suffix_length))
+            return range_result::ignore;
+        if (suffix_length == 0 || length == 0)
+            return range_result::unsatisfiable;
+
+        first = length - std::min(suffix_length, length);
+        last  = length - 1;
+    } else {
+        if (!parse_position(first_str, first))
+            return range_result::ignore;
+
+        if (last_str.empty())
+            last = length - 1;
+        else if (!parse_position(last_str, last) || last < first)
+            return range_result::ignore;
+
+        if (first >= length)
+            return range_result::unsatisfiable;
+        last = std::min(last, length - 1);
+    }
+
+    range = byte_range{first, last};
+    return range_result::satisfiable;
+}
+
+std::optional<std::size_t> range_encoded_size(const value_t& value)
+{
+    if (auto scalar = std::get_if<scalar_t>(&value)) {
+        if (auto str = std::get_if<string_t>(scalar))
+            return str->size();
+        if (auto bin = std::get_if<binary_t>(scalar))
+            return bin->size();
+        return std::nullopt;
+    }
+
+    if (auto seq = std::get_if<sequence_t>(&value)) {
+        if (seq->empty())
+            return 0;
+        if (auto elem_size = fixed_element_size(*seq))
+            return seq->size() * elem_size;
+        return encode(value).size();
+    }
+
+    return std::nullopt;
+}
+
+std::string encode_range(const value_t& value, byte_range range)
+{
+    const std::size_t count = range.last - range.first + 1;
+
+    if (auto scalar = std::get_if<scalar_t>(&value)) {
+        if (auto str = std::get_if<string_t>(scalar))
+            return str->substr(range.first, count);
+        if (auto bin = std::get_if<binary_t>(scalar))
+            return bin->substr(range.first, count);
+    }
+
+    if (auto seq = std::get_if<sequence_t>(&value)) {
+        if (auto elem_size = fixed_element_size(*seq)) {
+            // Encode only the elements overlapping the range
+            const auto first_elem = range.first / elem_size;
+            const auto last_elem  = range.last / elem_size;
+
+            sequence_t part;
+            part.insert(part.end(), seq->begin() + first_elem, seq->begin() + last_elem + 1);
+            return encode(part).substr(range.first - first_elem * elem_size, count);
+        }
+    }
+
+    return encode(value).substr(range.first, count);
+}
+
+} // namespace scgi
+
+} // namespace decof
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DECOF_SCGI_BYTE_RANGE_H
+#define DECOF_SCGI_BYTE_RANGE_H
+
+#include <decof/types.h>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace decof {
+
+namespace scgi {
+
+/// Inclusive range of bytes of an encoded value.
+struct byte_range
+{
+    std::size_t first;
+    std::size_t last;
+};
+
+/// Result of evaluating an HTTP @c Range header.
+enum class range_result { ignore, satisfiable, unsatisfiable };
+
+/**
+ * @brief Evaluates an HTTP @c Range header value.
+ *
+ * Only single byte ranges are supported. Other range units, multiple ranges
+ * and malformed values are ignored, i.e., the complete value is to be sent.
+ *
+ * @param header_value The @c Range header value, e.g., "bytes=0-499".
+ * @param length The length of the complete encoded value.
+ * @param range Receives the range if satisfiable.
+ */
+range_result parse_range(std::string_view header_value, std::size_t length, byte_range& range);
+
+/**
+ * @brief Returns the encoded length of a value that supports ranges.
+ *
+ * Ranges are supported for string, binary and sequence values in the
+ * encoding of the js_value_encoder. The length of string sequences requires
+ * encoding the complete value.
+ *
+ * @return The encoded length or nothing if the value does not support
+ * ranges.
+ */
+std::optional<std::size_t> range_encoded_size(const value_t& value);
+
+/**
+ * @brief Encodes the given range of a value.
+ *
+ * Only the sequence elements overlapping the range are encoded, except for
+ * string sequences.
+ *
+ * @pre @a range lies within the encoded value.
+ */
+std::string encode_range(const value_t& value, byte_range range);
+
+} // namespace scgi
+
+} // namespace decof
+
+#endif // DECOF_SCGI_BYTE_RANGE_H
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cbor_value_encoder.h"
+#include <decof/binary/codec.h>
+#include <cstring>
+#include <variant>
+
+namespace {
+
+// Major types
+constexpr std::uint8_t unsigned_integer = 0;
+constexpr std::uint8_t negative_integer = 1;
+constexpr std::uint8_t byte_string      = 2;
+constexpr std::uint8_t text_string      = 3;
+constexpr std::uint8_t array            = 4;
+constexpr std::uint8_t semantic_tag     = 6;
+
+// Simple values and floats
+constexpr char false_value   = '\xf4';
+constexpr char true_value    = '\xf5';
+constexpr char float64_value = '\xfb';
+
+// Typed array tags (RFC 8746)
+constexpr std::uint64_t uint8_array      = 64;
+constexpr std::uint64_t sint64_le_array  = 79;
+constexpr std::uint64_t float64_le_array = 87;
+
+} // Anonymous namespace
+
+namespace decof {
+
+namespace scgi {
+
+cbor_value_encoder::cbor_value_encoder(std::string& out) : m_out(out)
+{
+}
+
+void cbor_value_encoder::operator()(const scalar_t& arg) const
+{
+    std::visit(*this, arg);
+}
+
+void cbor_value_encoder::operator()(const sequence_t& arg) const
+{
+    if (!arg.empty()) {
+        if (std::holds_alternative<boolean_t>(arg.front())) {
+            write_head(semantic_tag, uint8_array);
+            write_head(byte_string, arg.size());
+            for (const auto& elem : arg)
+                m_out += static_cast<char>(std::get<boolean_t>(elem));
+            return;
+        } else if (std::holds_alternative<integer_t>(arg.front())) {
+            write_head(semantic_tag, sint64_le_array);
+            write_head(byte_string, arg.size() * sizeof(std::int64_t));
+            for (const auto& elem : arg)
+                write_le(m_out, static_cast<std::int64_t>(std::get<integer_t>(elem)));
+            return;
+        } else if (std::holds_alternative<real_t>(arg.front())) {
+            write_head(semantic_tag, float64_le_array);
+            write_head(byte_string, arg.size() * sizeof(double));
+            for (const auto& elem : arg)
+                write_le(m_out, static_cast<double>(std::get<real_t>(elem)));
+            return;
+        }
+    }
+
+    write_head(array, arg.size());
+    for (const auto& elem : arg)
+        std::visit(*this, elem);
+}
+
+void cbor_value_encoder::operator()(const tuple_t& arg) const
+{
+    write_head(array, arg.size());
+    for (const auto& elem : arg)
+        std::visit(*this, elem);
+}
+
+void cbor_value_encoder::operator()(const boolean_t& arg) const
+{
+    m_out += arg ? true_value : false_value;
+}
+
+void cbor_value_encoder::operator()(const integer_t& arg) const
+{
+    if (arg >= 0)
+        write_head(unsigned_integer, static_cast<std::uint64_t>(arg));
+    else
+        write_head(negative_integer, static_cast<std::uint64_t>(-1 - static_cast<std::int64_t>(arg)));
+}
+
+void cbor_value_encoder::operator()(const real_t& arg) const
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &arg, sizeof(bits));
+
+    m_out += float64_value;
+    for (int shift = 56; shift >= 0; shift -= 8)
+        m_out += static_cast<char>(bits >> shift);
+}
+
+void cbor_value_encoder::operator()(const string_t& arg) const
+{
+    write_head(text_string, arg.size());
+    m_out += arg;
+}
+
+void cbor_value_encoder::operator()(const binary_t& arg) const
+{
+    write_head(byte_string, arg.size());
+    m_out += arg;
+}
+
+void cbor_value_encoder::write_head(std::uint8_t major_type, std::uint64_t argument) const
+{
+    const char initial = static_cast<char>(major_type << 5);
+
+    int length;
+    if (argument < 24) {
+        m_out += static_cast<char>(initial | argument);
+        return;
+    } else if (argument <= 0xff) {
+        m_out += static_cast<char>(initial | 24);
+        length = 1;
+    } else if (argument <= 0xffff) {
+        m_out += static_cast<char>(initial | 25);
+        length = 2;
+    } else if (argument <= 0xffffffff) {
+        m_out += static_cast<char>(initial | 26);
+        length = 4;
+    } else {
+        m_out += static_cast<char>(initial | 27);
+        length = 8;
+    }
+
+    // Arguments are big endian
+    for (int i = length - 1; i >= 0; --i)
+        m_out += static_cast<char>(argument >> (8 * i));
+}
+
+} // namespace scgi
+
+} // namespace decof
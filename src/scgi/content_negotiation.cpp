@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "content_negotiation.h"
+#include <charconv>
+
+namespace {
+
+std::string_view trim(std::string_view str)
+{
+    const char* whitespace = " \t";
+
+    auto first = str.find_first_not_of(whitespace);
+    if (first == std::string_view::npos)
+        return std::string_view();
+
+    return str.substr(first, str.find_last_not_of(whitespace) - first + 1);
+}
+
+/// Returns the specificity of a media range for a media type or -1 if not matching.
+int match(std::string_view range, std::string_view type)
+{
+    if (range == "*/*")
+        return 0;
+
+    if (range.size() >= 2 && range.substr(range.size() - 2) == "/*") {
+        auto prefix = range.substr(0, range.size() - 1);
+        return type.substr(0, prefix.size()) == prefix ? 1 : -1;
+    }
+
+    return range == type ? 2 : -1;
+}
+
+double quality(std::string_view params)
+{
+    while (!params.empty()) {
+        auto semicolon_idx = params.find(';');
+        auto param         = trim(params.substr(0, semicolon_idx));
+
+        if (param.substr(0, 2) == "q=") {
+            double value = 0.0;
+            std::from_chars(param.data() + 2, param.data() + param.size(), value);
+            return value;
+        }
+
+        if (semicolon_idx == std::string_view::npos)
+            break;
+        params.remove_prefix(semicolon_idx + 1);
+    }
+
+    return 1.0;
+}
+
+} // Anonymous namespace
+
+namespace decof {
+
+namespace scgi {
+
+std::size_t select_media_type(std::string_view accept, std::initializer_list<std::string_view> offered)
+{
+    std::size_t selected         = 0;
+    double      selected_quality = 0.0;
+
+    std::size_t index = 0;
+    for (auto type : offered) {
+        int    best_specificity = -1;
+        double type_quality     = 0.0;
+
+        for (auto remaining = accept; !remaining.empty();) {
+            auto comma_idx = remaining.find(',');
+            auto element   = remaining.substr(0, comma_idx);
+
+            auto semicolon_idx = element.find(';');
+            auto range         = trim(element.substr(0, semicolon_idx));
+            auto specificity   = match(range, type);
+            if (specificity > best_specificity) {
+                best_specificity = specificity;
+                type_quality =
+                    semicolon_idx == std::string_view::npos ? 1.0 : quality(element.substr(semicolon_idx + 1));
+            }
+
+            if (comma_idx == std::string_view::npos)
+                break;
+            remaining.remove_prefix(comma_idx + 1);
+        }
+
+        if (type_quality > selected_quality) {
+            selected         = index;
+            selected_quality = type_quality;
+        }
+
+        ++index;
+    }
+
+    return selected;
+}
+
+} // namespace scgi
+
+} // namespace decof
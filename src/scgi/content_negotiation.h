@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DECOF_SCGI_CONTENT_NEGOTIATION_H
+#define DECOF_SCGI_CONTENT_NEGOTIATION_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <string_view>
+
+namespace decof {
+
+namespace scgi {
+
+/**
+ * @brief Selects the media type preferred by an HTTP @c Accept header.
+ *
+ * Each offered media type is weighted with the quality value of the most
+ * specific matching media range, including the wildcard ranges for all
+ * types and for all subtypes of a type. Ties are resolved in favour of the
+ * earlier offered type.
+ *
+ * @param accept The @c Accept header value, possibly empty.
+ * @param offered The media types the server can produce in order of
+ * preference.
+ * @return The index of the selected media type. If the header is empty or
+ * none of the types is acceptable, the first type is selected.
+ */
+std::size_t select_media_type(std::string_view accept, std::initializer_list<std::string_view> offered);
+
+} // namespace scgi
+
+} // namespace decof
+
+#endif // DECOF_SCGI_CONTENT_NEGOTIATION_H
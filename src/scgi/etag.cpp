@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "etag.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace decof {
+
+namespace scgi {
+
+std::string make_etag(std::uint64_t value)
+{
+    char buf[20];
+    int  n = std::snprintf(buf, sizeof(buf), "\"%016llx\"", static_cast<unsigned long long>(value));
+    return std::string(buf, n);
+}
+
+std::string make_etag(std::uint64_t value, std::string_view suffix)
+{
+    if (suffix.empty())
+        return make_etag(value);
+
+    char buf[18];
+    int  n = std::snprintf(buf, sizeof(buf), "\"%016llx", static_cast<unsigned long long>(value));
+
+    std::string retval(buf, n);
+    retval += '-';
+    retval += suffix;
+    retval += '"';
+    return retval;
+}
+
+std::string make_etag(std::string_view content)
+{
+    // 64 bit FNV-1a hash
+    std::uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : content) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+
+    return make_etag(hash);
+}
+
+bool if_none_match(std::string_view header_value, std::string_view etag)
+{
+    while (!header_value.empty()) {
+        auto        comma_idx = header_value.find(',');
+        auto        tag       = header_value.substr(0, comma_idx);
+        std::size_t first     = tag.find_first_not_of(" \t");
+        std::size_t last      = tag.find_last_not_of(" \t");
+
+        if (first != std::string_view::npos) {
+            tag = tag.substr(first, last - first + 1);
+
+            // Weak comparison is used for If-None-Match (RFC 7232, 3.2)
+            if (tag.substr(0, 2) == "W/")
+                tag.remove_prefix(2);
+
+            if (tag == "*" || tag == etag)
+                return true;
+        }
+
+        header_value.remove_prefix(std::min(comma_idx, header_value.size() - 1) + 1);
+    }
+
+    return false;
+}
+
+} // namespace scgi
+
+} // namespace decof
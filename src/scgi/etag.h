@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DECOF_SCGI_ETAG_H
+#define DECOF_SCGI_ETAG_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace decof {
+
+namespace scgi {
+
+/// Returns a strong entity tag (including quotes) for the given value.
+std::string make_etag(std::uint64_t value);
+
+/// Returns a strong entity tag (including quotes) for the given value and
+/// the representation denoted by @a suffix, e.g., a media type.
+std::string make_etag(std::uint64_t value, std::string_view suffix);
+
+/// Returns a strong entity tag (including quotes) for the given content.
+std::string make_etag(std::string_view content);
+
+/**
+ * @brief Evaluates an HTTP @c If-None-Match header value.
+ *
+ * @param header_value The comma separated list of entity tags or "*".
+ * @param etag The current entity tag of the resource.
+ * @return @c true if @a etag matches the list, i.e., the client's copy is
+ * up to date.
+ */
+bool if_none_match(std::string_view header_value, std::string_view etag);
+
+} // namespace scgi
+
+} // namespace decof
+
+#endif // DECOF_SCGI_ETAG_H
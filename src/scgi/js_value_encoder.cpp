@@ -15,7 +15,7 @@
  */
 
 #include "js_value_encoder.h"
-#include "endian.h"
+#include <decof/byte_order.h>
 #include <iomanip>
 #include <variant>
 
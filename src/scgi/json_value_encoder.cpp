@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "json_value_encoder.h"
+#include <charconv>
+#include <cmath>
+#include <variant>
+
+namespace decof {
+
+namespace scgi {
+
+json_value_encoder::json_value_encoder(std::string& out) : m_out(out)
+{
+}
+
+void json_value_encoder::operator()(const scalar_t& arg) const
+{
+    std::visit(*this, arg);
+}
+
+void json_value_encoder::operator()(const sequence_t& arg) const
+{
+    m_out += '[';
+    for (auto it = arg.cbegin(); it != arg.cend(); ++it) {
+        if (it != arg.cbegin())
+            m_out += ',';
+        std::visit(*this, *it);
+    }
+    m_out += ']';
+}
+
+void json_value_encoder::operator()(const tuple_t& arg) const
+{
+    m_out += '[';
+    for (auto it = arg.cbegin(); it != arg.cend(); ++it) {
+        if (it != arg.cbegin())
+            m_out += ',';
+        std::visit(*this, *it);
+    }
+    m_out += ']';
+}
+
+void json_value_encoder::operator()(const boolean_t& arg) const
+{
+    m_out += arg ? "true" : "false";
+}
+
+void json_value_encoder::operator()(const integer_t& arg) const
+{
+    char buf[24];
+    auto result = std::to_chars(buf, buf + sizeof(buf), arg);
+    m_out.append(buf, result.ptr);
+}
+
+void json_value_encoder::operator()(const real_t& arg) const
+{
+    // JSON does not support non-finite numbers
+    if (!std::isfinite(arg)) {
+        m_out += "null";
+        return;
+    }
+
+    // Shortest representation that converts back to the same value
+    char buf[32];
+    auto result = std::to_chars(buf, buf + sizeof(buf), arg);
+    m_out.append(buf, result.ptr);
+}
+
+void json_value_encoder::operator()(const string_t& arg) const
+{
+    static const char hex_digits[] = "0123456789abcdef";
+
+    m_out.reserve(m_out.size() + arg.size() + 2);
+    m_out += '"';
+    for (char c : arg) {
+        switch (c) {
+            case '"':
+                m_out += "\\\"";
+                break;
+            case '\\':
+                m_out += "\\\\";
+                break;
+            case '\n':
+                m_out += "\\n";
+                break;
+            case '\r':
+                m_out += "\\r";
+                break;
+            case '\t':
+                m_out += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    m_out += "\\u00";
+                    m_out += hex_digits[(c >> 4) & 0xf];
+                    m_out += hex_digits[c & 0xf];
+                } else
+                    m_out += c;
+        }
+    }
+    m_out += '"';
+}
+
+void json_value_encoder::operator()(const binary_t& arg) const
+{
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    m_out.reserve(m_out.size() + (arg.size() + 2) / 3 * 4 + 2);
+    m_out += '"';
+
+    std::size_t i = 0;
+    for (; i + 2 < arg.size(); i += 3) {
+        unsigned n = static_cast<unsigned char>(arg[i]) << 16 | static_cast<unsigned char>(arg[i + 1]) << 8 |
+            static_cast<unsigned char>(arg[i + 2]);
+        const char quad[] = {alphabet[n >> 18 & 0x3f], alphabet[n >> 12 & 0x3f], alphabet[n >> 6 & 0x3f],
+                             alphabet[n & 0x3f]};
+        m_out.append(quad, sizeof(quad));
+    }
+
+    if (i + 1 == arg.size()) {
+        unsigned   n      = static_cast<unsigned char>(arg[i]) << 16;
+        const char quad[] = {alphabet[n >> 18 & 0x3f], alphabet[n >> 12 & 0x3f], '=', '='};
+        m_out.append(quad, sizeof(quad));
+    } else if (i + 2 == arg.size()) {
+        unsigned n = static_cast<unsigned char>(arg[i]) << 16 | static_cast<unsigned char>(arg[i + 1]) << 8;
+        const char quad[] = {alphabet[n >> 18 & 0x3f], alphabet[n >> 12 & 0x3f], alphabet[n >> 6 & 0x3f], '='};
+        m_out.append(quad, sizeof(quad));
+    }
+
+    m_out += '"';
+}
+
+} // namespace scgi
+
+} // namespace decof
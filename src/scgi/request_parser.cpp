@@ -15,18 +15,90 @@
  */
 
 #include <decof/scgi/request_parser.h>
-#include <boost/algorithm/string/classification.hpp>
-#include <boost/algorithm/string/split.hpp>
-#include <boost/lexical_cast.hpp>
-#include <cctype>
-#include <string>
-#include <vector>
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <limits>
+
+namespace {
+
+/// Maximum number of digits of the header netstring length.
+const std::size_t max_length_digits = 9;
+
+/// Maximum size of the header netstring.
+const std::size_t max_header_size = 64 * 1024;
+
+/// Parses a decimal number, returns false on failure.
+bool parse_size(std::string_view str, std::size_t& value)
+{
+    if (str.empty())
+        return false;
+
+    const auto result = std::from_chars(str.data(), str.data() + str.size(), value);
+    return result.ec == std::errc() && result.ptr == str.data() + str.size();
+}
+
+} // Anonymous namespace
 
 namespace decof {
 
 namespace scgi {
 
-request_parser::request_parser()
+std::string_view header_list::at(std::string_view name) const
+{
+    if (auto value = find(name))
+        return *value;
+
+    throw std::out_of_range("Unknown SCGI header");
+}
+
+const std::string_view* header_list::find(std::string_view name) const
+{
+    // Later headers take precedence
+    for (auto it = headers_.rbegin(); it != headers_.rend(); ++it) {
+        if (it->first == name)
+            return &it->second;
+    }
+
+    return nullptr;
+}
+
+std::size_t header_list::count(std::string_view name) const
+{
+    return find(name) != nullptr ? 1 : 0;
+}
+
+std::size_t header_list::size() const
+{
+    return headers_.size();
+}
+
+bool header_list::empty() const
+{
+    return headers_.empty();
+}
+
+header_list::const_iterator header_list::begin() const
+{
+    return headers_.begin();
+}
+
+header_list::const_iterator header_list::end() const
+{
+    return headers_.end();
+}
+
+void header_list::clear()
+{
+    headers_.clear();
+}
+
+void header_list::emplace_back(std::string_view name, std::string_view value)
+{
+    headers_.emplace_back(name, value);
+}
+
+request_parser::request_parser() : max_body_size_(std::numeric_limits<std::size_t>::max())
 {
     reset();
 }
@@ -35,110 +107,119 @@ void request_parser::reset()
 {
     state_ = netstring_length;
     method = method_type::undefined;
-    uri.clear();
+    uri    = std::string_view();
     headers.clear();
+    content_type = std::string_view();
+    encoding     = std::string_view();
     body.clear();
-    netstring_length_str_.clear();
-    current_header_.clear();
-    current_value_.clear();
-    content_length_ = 0;
+    header_buf_.clear();
+    netstring_length_ = 0;
+    content_length_   = 0;
+    body_size_        = 0;
+}
+
+void request_parser::max_body_size(std::size_t size) noexcept
+{
+    max_body_size_ = size;
 }
 
-request_parser::result_type request_parser::consume(char input) noexcept
+std::pair<char*, std::size_t> request_parser::pending_body() noexcept
+{
+    if (state_ != body_range)
+        return {nullptr, 0};
+
+    return {&body[body_size_], content_length_ - body_size_};
+}
+
+request_parser::result_type request_parser::body_received(std::size_t n) noexcept
+{
+    if (state_ != body_range || n > content_length_ - body_size_)
+        return bad;
+
+    body_size_ += n;
+    if (body_size_ < content_length_)
+        return indeterminate;
+
+    state_ = done;
+    return good;
+}
+
+request_parser::result_type request_parser::parse(const char* begin, const char* end) noexcept
 {
     try {
-        netstring_count_ += 1;
-
-        switch (state_) {
-            case netstring_length:
-                if (std::isdigit(input))
-                    netstring_length_str_.push_back(input);
-                else if (input == ':') {
-                    netstring_length_ = boost::lexical_cast<size_t>(netstring_length_str_);
-                    netstring_count_  = 0;
-                    state_            = header_start;
-                } else
-                    return bad;
-                break;
-            case header_start:
-            case header_name:
-                if (state_ == header_start && input == ',') {
-                    if (netstring_length_ == netstring_count_ - 1) {
-                        if (content_length_ > 0)
-                            state_ = body_range;
-                        else
-                            return good;
-                    } else
+        while (begin != end) {
+            switch (state_) {
+                case netstring_length: {
+                    // Collect length digits up to the colon
+                    auto colon = static_cast<const char*>(std::memchr(begin, ':', end - begin));
+                    auto last  = colon != nullptr ? colon : end;
+
+                    if (header_buf_.size() + (last - begin) > max_length_digits)
                         return bad;
-                } else if (netstring_count_ < netstring_length_) {
-                    if (input == '\0') {
-                        if (current_header_.size() > 0)
-                            state_ = header_value;
-                        else
-                            return bad;
-                    } else
-                        current_header_.push_back(input);
-                } else
-                    return bad;
-                break;
-            case header_value:
-                if (netstring_count_ <= netstring_length_) {
-                    if (input == '\0') {
-                        // Check whether first header is CONTENT_LENGTH
-                        if (headers.empty()) {
-                            if (current_header_ == "CONTENT_LENGTH")
-                                content_length_ = boost::lexical_cast<size_t>(current_value_);
-                            else
-                                return bad;
-                        }
-
-                        // Check if 2nd header is SCGI
-                        if (headers.size() == 1 && !(current_header_ == "SCGI" && current_value_ == "1"))
-                            return bad;
-
-                        if (current_header_ == "REQUEST_METHOD") {
-                            if (current_value_ == "GET")
-                                method = method_type::get;
-                            else if (current_value_ == "PUT")
-                                method = method_type::put;
-                            else if (current_value_ == "POST")
-                                method = method_type::post;
-                        } else if (current_header_ == "REQUEST_URI") {
-                            uri = current_value_;
-                        } else if (current_header_ == "CONTENT_TYPE") {
-                            // Split content type value into parts
-                            std::vector<std::string> content_type_values;
-                            boost::algorithm::split(
-                                content_type_values,
-                                current_value_,
-                                boost::is_any_of("; \t"),
-                                boost::algorithm::token_compress_on);
-                            try {
-                                content_type = content_type_values.at(0);
-                                encoding     = content_type_values.at(1);
-                            } catch (std::out_of_range&) {
-                            }
-                        }
-
-                        headers[current_header_].swap(current_value_);
-                        current_header_.clear();
-                        current_value_.clear();
-
-                        state_ = header_start;
-                    } else
-                        current_value_.push_back(input);
-                } else
-                    return bad;
-                break;
-            case body_range:
-                if (body.size() <= content_length_) {
-                    body.push_back(input);
+                    header_buf_.append(begin, last);
+                    begin = last;
+
+                    if (colon == nullptr)
+                        return indeterminate;
+
+                    if (!parse_size(header_buf_, netstring_length_))
+                        return bad;
+
+                    // The buffer grows with the data actually received
+                    if (netstring_length_ > max_header_size) {
+                        state_ = done;
+                        return too_large;
+                    }
+                    header_buf_.clear();
+
+                    ++begin;
+                    state_ = header_range;
+                    break;
+                }
+                case header_range: {
+                    const auto count = std::min<std::size_t>(end - begin, netstring_length_ - header_buf_.size());
+                    header_buf_.append(begin, count);
+                    begin += count;
+
+                    if (header_buf_.size() == netstring_length_)
+                        state_ = header_end;
+                    break;
+                }
+                case header_end: {
+                    if (*begin++ != ',')
+                        return bad;
+
+                    auto result = parse_headers();
+                    if (result == bad)
+                        return bad;
+
+                    if (content_length_ == 0) {
+                        state_ = done;
+                        return good;
+                    }
 
-                    if (body.size() == content_length_)
+                    // Reject oversized bodies before receiving them
+                    if (content_length_ > max_body_size_) {
+                        state_ = done;
+                        return too_large;
+                    }
+
+                    body.resize(content_length_);
+                    state_ = body_range;
+                    break;
+                }
+                case body_range: {
+                    const auto count = std::min<std::size_t>(end - begin, content_length_ - body_size_);
+                    std::memcpy(&body[body_size_], begin, count);
+                    begin += count;
+
+                    if (body_received(count) == good)
                         return good;
-                } else
+                    break;
+                }
+                case done:
                     return bad;
-                break;
+            }
         }
     } catch (...) {
         return bad;
@@ -147,6 +228,59 @@ request_parser::result_type request_parser::consume(char input) noexcept
     return indeterminate;
 }
 
+request_parser::result_type request_parser::parse_headers()
+{
+    const char* pos  = header_buf_.data();
+    const char* last = pos + header_buf_.size();
+
+    while (pos != last) {
+        auto name_end = static_cast<const char*>(std::memchr(pos, '\0', last - pos));
+        if (name_end == nullptr || name_end == pos)
+            return bad;
+
+        auto value_end = static_cast<const char*>(std::memchr(name_end + 1, '\0', last - name_end - 1));
+        if (value_end == nullptr)
+            return bad;
+
+        const std::string_view name(pos, name_end - pos);
+        const std::string_view value(name_end + 1, value_end - name_end - 1);
+
+        // First header must be CONTENT_LENGTH, second SCGI with value 1
+        if (headers.empty()) {
+            if (name != "CONTENT_LENGTH" || !parse_size(value, content_length_))
+                return bad;
+        } else if (headers.size() == 1 && !(name == "SCGI" && value == "1"))
+            return bad;
+
+        if (name == "REQUEST_METHOD") {
+            if (value == "GET")
+                method = method_type::get;
+            else if (value == "PUT")
+                method = method_type::put;
+            else if (value == "POST")
+                method = method_type::post;
+        } else if (name == "REQUEST_URI") {
+            uri = value;
+        } else if (name == "CONTENT_TYPE") {
+            // Split content type value into media type and parameter
+            const char* separators = "; \t";
+            auto        type_end   = value.find_first_of(separators);
+            content_type           = value.substr(0, type_end);
+
+            auto param_begin = value.find_first_not_of(separators, type_end);
+            if (type_end != std::string_view::npos && param_begin != std::string_view::npos) {
+                auto param_end = value.find_first_of(separators, param_begin);
+                encoding       = value.substr(param_begin, param_end - param_begin);
+            }
+        }
+
+        headers.emplace_back(name, value);
+        pos = value_end + 1;
+    }
+
+    return good;
+}
+
 } // namespace scgi
 
 } // namespace decof
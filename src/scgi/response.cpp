@@ -15,14 +15,25 @@
  */
 
 #include <decof/scgi/response.h>
-#include <map>
-#include <sstream>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <iterator>
+#include <stdexcept>
+#include <string>
 
 namespace {
 
 using decof::scgi::response;
 
-static std::map<response::status_code, const char*> http_response_texts = {
+struct status_entry
+{
+    response::status_code status;
+    const char*           text;
+};
+
+/// Status texts sorted by status code.
+const status_entry status_entries[] = {
     {response::status_code::ok, "OK"},
     {response::status_code::created, "Created"},
     {response::status_code::accepted, "Accepted"},
@@ -40,6 +51,7 @@ static std::map<response::status_code, const char*> http_response_texts = {
     {response::status_code::not_acceptable, "Not Acceptable"},
     {response::status_code::request_timeout, "Request Timeout"},
     {response::status_code::precondition_failed, "Precondition Failed"},
+    {response::status_code::payload_too_large, "Payload Too Large"},
     {response::status_code::unsatisfiable_range, "Requested Range Not Satisfiable"},
     {response::status_code::internal_server_error, "Internal Server Error"},
     {response::status_code::not_implemented, "Not Implemented"},
@@ -47,15 +59,102 @@ static std::map<response::status_code, const char*> http_response_texts = {
     {response::status_code::service_unavailable, "Service Unavailable"},
     {response::status_code::space_unavailable, "Insufficient Space to Store Resource"}};
 
+constexpr std::size_t status_entry_count = sizeof(status_entries) / sizeof(status_entries[0]);
+
+/// Returns the index of the given status in #status_entries.
+/// @throw std::out_of_range if the status is unknown.
+std::size_t status_index(response::status_code status)
+{
+    auto it = std::lower_bound(
+        std::begin(status_entries), std::end(status_entries), status, [](const status_entry& entry, auto value) {
+            return entry.status < value;
+        });
+
+    if (it == std::end(status_entries) || it->status != status)
+        throw std::out_of_range("unknown status code");
+
+    return static_cast<std::size_t>(it - std::begin(status_entries));
+}
+
+void append_number(std::string& out, std::size_t value)
+{
+    char buf[20];
+    auto result = std::to_chars(buf, buf + sizeof(buf), value);
+    out.append(buf, result.ptr);
+}
+
 } // Anonymous namespace
 
 namespace decof {
 
 namespace scgi {
 
+std::string& response_headers::operator[](std::string_view name)
+{
+    if (auto it = find(name); it != headers_.end())
+        return it->second;
+
+    headers_.emplace_back(std::string(name), std::string());
+    return headers_.back().second;
+}
+
+response_headers::iterator response_headers::find(std::string_view name)
+{
+    return std::find_if(headers_.begin(), headers_.end(), [name](const value_type& header) {
+        return header.first == name;
+    });
+}
+
+response_headers::const_iterator response_headers::find(std::string_view name) const
+{
+    return std::find_if(headers_.begin(), headers_.end(), [name](const value_type& header) {
+        return header.first == name;
+    });
+}
+
+std::size_t response_headers::count(std::string_view name) const
+{
+    return find(name) != headers_.end() ? 1 : 0;
+}
+
+std::size_t response_headers::size() const
+{
+    return headers_.size();
+}
+
+bool response_headers::empty() const
+{
+    return headers_.empty();
+}
+
+response_headers::iterator response_headers::begin()
+{
+    return headers_.begin();
+}
+
+response_headers::iterator response_headers::end()
+{
+    return headers_.end();
+}
+
+response_headers::const_iterator response_headers::begin() const
+{
+    return headers_.begin();
+}
+
+response_headers::const_iterator response_headers::end() const
+{
+    return headers_.end();
+}
+
+void response_headers::clear()
+{
+    headers_.clear();
+}
+
 std::string response::status_text() const
 {
-    return http_response_texts.at(status);
+    return status_entries[status_index(status)].text;
 }
 
 response response::stock_response(response::status_code status)
@@ -65,6 +164,106 @@ response response::stock_response(response::status_code status)
     return resp;
 }
 
+bool response::has_body() const
+{
+    // No body allowed in other stati
+    // (see http://www.w3.org/Protocols/rfc2616/rfc2616-sec4.html#sec4.4)
+    return !((status >= status_code::continue_ && status < status_code::ok) || status == status_code::no_content ||
+             status == status_code::not_modified);
+}
+
+std::string response::header() const
+{
+    std::string retval;
+    retval.reserve(128);
+    write_header(retval);
+    return retval;
+}
+
+void response::write_header(std::string& out) const
+{
+    out += "HTTP/1.1 ";
+    append_number(out, static_cast<std::size_t>(status));
+    out += ' ';
+    out += status_entries[status_index(status)].text;
+    out += "\r\n";
+
+    for (const auto& header : headers) {
+        out += header.first;
+        out += ": ";
+        out += header.second;
+        out += "\r\n";
+    }
+    if (headers.count("Content-Type") == 0)
+        out += "Content-Type: text/plain\r\n";
+
+    if (has_body() && !unbounded_body) {
+        out += "Content-Length: ";
+        append_number(out, content().size());
+        out += "\r\n";
+    }
+
+    out += "\r\n";
+}
+
+bool response::is_stock() const
+{
+    return headers.empty() && body.empty() && !shared_body && !unbounded_body;
+}
+
+std::string_view response::stock_bytes(status_code status)
+{
+    // Formatted once on first use
+    static const auto table = []() {
+        std::array<std::string, status_entry_count> retval;
+        for (std::size_t i = 0; i < status_entry_count; ++i)
+            retval[i] = stock_response(status_entries[i].status).header();
+        return retval;
+    }();
+
+    return table[status_index(status)];
+}
+
+void response::serialize(output_buffer& buf)
+{
+    // The header is formatted into a temporary, so it counts as copied
+    if (is_stock())
+        buf.append_static(stock_bytes(status));
+    else
+        buf.append(std::string_view(header()));
+
+    serialize_body(buf);
+}
+
+void response::serialize(output_buffer& buf, std::string& header_buf)
+{
+    if (is_stock()) {
+        buf.append_static(stock_bytes(status));
+    } else {
+        header_buf.clear();
+        write_header(header_buf);
+        buf.append_static(header_buf);
+    }
+
+    serialize_body(buf);
+}
+
+void response::serialize_body(output_buffer& buf)
+{
+    if (has_body()) {
+        if (shared_body)
+            buf.append(shared_body);
+        else
+            buf.append(std::move(body));
+    }
+    body.clear();
+}
+
+const std::string& response::content() const
+{
+    return shared_body ? *shared_body : body;
+}
+
 } // namespace scgi
 
 } // namespace decof
@@ -15,18 +15,33 @@
  */
 
 #include "array_view.h"
+#include "batch.h"
 #include "bencode_string_parser.h"
-#include "endian.h"
+#include "browse_cache.h"
+#include "byte_range.h"
+#include "cbor_value_encoder.h"
+#include "content_negotiation.h"
+#include "etag.h"
 #include "js_value_encoder.h"
+#include "json_value_encoder.h"
 #include "xml_visitor.h"
+#include <decof/binary/codec.h>
+#include <decof/byte_order.h>
 #include <decof/exceptions.h>
+#include <decof/node.h>
 #include <decof/object_dictionary.h>
 #include <decof/scgi/scgi_context.h>
+#include <decof/statistics.h>
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/any.hpp>
+#include <boost/asio/read.hpp>
 #include <boost/asio/write.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/variant/apply_visitor.hpp>
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <functional>
 #include <ostream>
 #include <variant>
 
@@ -36,11 +51,125 @@ namespace decof {
 
 namespace scgi {
 
+namespace {
+
+/// Generated object tree descriptions shared by all SCGI connections.
+browse_cache browse_cache_;
+
+/// Path of batch read requests.
+constexpr std::string_view batch_path = "/batch";
+
+/// Path of event stream requests.
+constexpr std::string_view events_path = "/events";
+
+/// Path of heat map reports.
+constexpr std::string_view heat_path = "/heat";
+
+/// Number of records of a heat map report by default.
+constexpr std::size_t default_heat_count = 10;
+
+/// Media type of binary encoded tuples.
+constexpr std::string_view tuple_content_type = "vnd/com.toptica.decof.tuple";
+
+/// Media types of parameter values in order of preference.
+constexpr std::string_view plain_content_type = "text/plain";
+constexpr std::string_view json_content_type  = "application/json";
+constexpr std::string_view cbor_content_type  = "application/cbor";
+
+/// Indices of the media types offered to content negotiation.
+enum representation : std::size_t {
+    plain_representation,
+    json_representation,
+    cbor_representation,
+    tuple_representation
+};
+
+/// Entity tag suffixes of the representations; plain values use the bare
+/// version as entity tag.
+constexpr std::string_view etag_suffixes[] = {"", "json", "cbor", "tuple"};
+
+/// Result of reading a parameter on the object dictionary strand.
+struct parameter_read
+{
+    value_t       value;
+    std::uint64_t version      = 0;
+    bool          not_modified = false;
+};
+
+/// Result of reading a batch item on the object dictionary strand.
+using batch_read = std::pair<batch_item, value_t>;
+
+/// Parses the query string of a heat map report request, e.g.,
+/// @c top=20&sort=time.
+std::pair<std::size_t, heat_map::sort_key> heat_query(std::string_view query)
+{
+    std::size_t        count = default_heat_count;
+    heat_map::sort_key key   = heat_map::sort_key::count;
+
+    while (!query.empty()) {
+        auto amp_idx = query.find('&');
+        auto param   = query.substr(0, amp_idx);
+        query.remove_prefix(std::min(amp_idx, query.size() - 1) + 1);
+
+        auto eq_idx = param.find('=');
+        if (eq_idx == std::string_view::npos)
+            throw parse_error();
+
+        auto name  = param.substr(0, eq_idx);
+        auto value = param.substr(eq_idx + 1);
+        if (name == "top") {
+            if (std::from_chars(value.data(), value.data() + value.size(), count).ec != std::errc())
+                throw parse_error();
+        } else if (name == "sort" && value == "count")
+            key = heat_map::sort_key::count;
+        else if (name == "sort" && value == "time")
+            key = heat_map::sort_key::time;
+        else
+            throw parse_error();
+    }
+
+    return {count, key};
+}
+
+} // Anonymous namespace
+
+std::size_t scgi_context::max_body_size_ = 16 * 1024 * 1024;
+
 scgi_context::scgi_context(strand_t& strand, socket_t&& socket, object_dictionary& od, userlevel_t userlevel)
-  : client_context(od, userlevel), strand_(strand), socket_(std::move(socket))
+  : client_context(od, userlevel),
+    dictionary_strand_(strand),
+    strand_(strand.context()),
+    flush_scheduler_(boost::asio::use_service<flush_scheduler>(strand.context())),
+    socket_(std::move(socket)),
+    inbuf_(inbuf_size_)
 {
 }
 
+template <typename Access, typename Complete>
+void scgi_context::access_dictionary(Access access, Complete complete)
+{
+    auto self = shared_from_this();
+    dictionary_strand_.post([self, access, complete]() {
+        try {
+            auto result = access();
+            self->strand_.post([self, complete, result = std::move(result)]() mutable {
+                try {
+                    complete(std::move(result));
+                } catch (...) {
+                    self->handle_exception(std::current_exception());
+                }
+            });
+        } catch (...) {
+            self->strand_.post([self, ex = std::current_exception()]() { self->handle_exception(ex); });
+        }
+    });
+}
+
+void scgi_context::max_body_size(std::size_t size) noexcept
+{
+    max_body_size_ = size;
+}
+
 std::string scgi_context::connection_type() const
 {
     return "scgi";
@@ -62,68 +191,272 @@ void scgi_context::preload()
 void scgi_context::read_handler(const error_code& error, std::size_t bytes_transferred)
 {
     if (!error) {
-        try {
-            auto result = parser_.parse(inbuf_.data(), inbuf_.data() + bytes_transferred);
-
-            if (result == request_parser::good) {
-                remote_endpoint_ = std::string("scgi://") + parser_.headers.at("REMOTE_ADDR") + ":" +
-                    parser_.headers.at("REMOTE_PORT");
-
-                if (parser_.method == request_parser::method_type::get)
-                    handle_get_request();
-                else if (parser_.method == request_parser::method_type::put)
-                    handle_put_request();
-                else if (parser_.method == request_parser::method_type::post)
-                    handle_post_request();
-                else
-                    throw parse_error();
-            } else if (result == request_parser::bad)
-                throw parse_error();
-            else
-                preload();
-        } catch (access_denied_error&) {
-            send_response(response::stock_response(response::status_code::unauthorized));
-        } catch (invalid_parameter_error&) {
-            send_response(response::stock_response(response::status_code::not_found));
-        } catch (runtime_error&) {
-            send_response(response::stock_response(response::status_code::bad_request));
-        } catch (std::out_of_range&) {
-            send_response(response::stock_response(response::status_code::bad_request));
-        } catch (...) {
-            send_response(response::stock_response(response::status_code::internal_server_error));
-        }
+        statistics::count_bytes_in(protocol_type::scgi, bytes_transferred);
+
+        // Apply the limit at the time of the request rather than of connecting
+        parser_.max_body_size(max_body_size_);
+        process_result(parser_.parse(inbuf_.data(), inbuf_.data() + bytes_transferred));
     } else
         disconnect();
 }
 
-void scgi_context::handle_get_request()
+void scgi_context::body_handler(const error_code& error, std::size_t bytes_transferred)
+{
+    if (!error) {
+        statistics::count_bytes_in(protocol_type::scgi, bytes_transferred);
+        process_result(parser_.body_received(bytes_transferred));
+    } else
+        disconnect();
+}
+
+void scgi_context::process_result(request_parser::result_type result)
 {
-    std::ostringstream body_oss;
-    response           resp = response::stock_response(response::status_code::ok);
+    try {
+        if (result == request_parser::good) {
+            request_received_ = std::chrono::steady_clock::now();
+
+            remote_endpoint_ = "scgi://";
+            remote_endpoint_ += parser_.headers.at("REMOTE_ADDR");
+            remote_endpoint_ += ":";
+            remote_endpoint_ += parser_.headers.at("REMOTE_PORT");
+
+            if (parser_.method == request_parser::method_type::get)
+                handle_get_request();
+            else if (parser_.method == request_parser::method_type::put)
+                handle_put_request();
+            else if (parser_.method == request_parser::method_type::post)
+                handle_post_request();
+            else
+                throw parse_error();
+        } else if (result == request_parser::too_large) {
+            // The rest of the request is not read, so the connection cannot be continued
+            disconnect_after_write_ = true;
+            send_response(response::stock_response(response::status_code::payload_too_large));
+        } else if (result == request_parser::bad)
+            throw parse_error();
+        else if (auto body = parser_.pending_body(); body.second > 0) {
+            // Receive the remaining body in one go straight into its storage
+            auto self = shared_from_this();
+            boost::asio::async_read(socket_,
+                                    boost::asio::buffer(body.first, body.second),
+                                    strand_.wrap([self](const error_code& err, std::size_t bytes) {
+                                        self->body_handler(err, bytes);
+                                    }));
+        } else
+            preload();
+    } catch (...) {
+        handle_exception(std::current_exception());
+    }
+}
 
+void scgi_context::handle_exception(std::exception_ptr ex)
+{
+    try {
+        std::rethrow_exception(ex);
+    } catch (access_denied_error&) {
+        send_response(response::stock_response(response::status_code::unauthorized));
+    } catch (invalid_parameter_error&) {
+        send_response(response::stock_response(response::status_code::not_found));
+    } catch (runtime_error&) {
+        send_response(response::stock_response(response::status_code::bad_request));
+    } catch (std::out_of_range&) {
+        send_response(response::stock_response(response::status_code::bad_request));
+    } catch (...) {
+        send_response(response::stock_response(response::status_code::internal_server_error));
+    }
+}
+
+void scgi_context::handle_get_request()
+{
     if (parser_.uri == "/browse" || parser_.uri == "/browse/") {
-        resp.headers["Content-Type"] = "text/xml";
-        xml_visitor visitor(body_oss);
-        browse_object(&object_dictionary_, &visitor);
-    } else {
-        resp.headers["Content-Type"] = "text/plain";
+        handle_browse_request();
+        return;
+    }
+
+    auto path  = parser_.uri.substr(0, parser_.uri.find('?'));
+    auto query = parser_.uri.substr(std::min(path.size() + 1, parser_.uri.size()));
+
+    if (path == batch_path) {
+        handle_batch_request(batch_uris_from_query(query));
+        return;
+    } else if (path == events_path) {
+        handle_event_stream_request(batch_uris_from_query(query));
+        return;
+    } else if (path == heat_path) {
+        handle_heat_request(query);
+        return;
+    }
 
-        auto const& value = get_parameter(object_dictionary_.find_object(parser_.uri, '/'));
+    statistics::count_request(request_type::get);
+
+    auto if_none_match_value = parser_.headers.find("HTTP_IF_NONE_MATCH");
+    auto if_none_match_str   = if_none_match_value != nullptr ? std::string(*if_none_match_value) : std::string();
+
+    // Negotiate the value encoding; tuples are also offered in binary
+    auto       accept         = parser_.headers.find("HTTP_ACCEPT");
+    const auto accept_value   = accept != nullptr ? *accept : std::string_view();
+    const auto selected =
+        select_media_type(accept_value, {plain_content_type, json_content_type, cbor_content_type});
+    const auto selected_tuple = select_media_type(
+        accept_value, {plain_content_type, json_content_type, cbor_content_type, tuple_content_type});
+
+    // The value is read on the object dictionary strand and encoded on the
+    // connection strand
+    access_dictionary(
+        [this, uri = std::string(parser_.uri), if_none_match_str, selected, selected_tuple]() {
+            parameter_read result;
+            auto           obj = object_dictionary_.find_object(uri, '/');
+
+            // Answer conditional requests for unchanged values without reading
+            // them, unless the representation depends on the value type
+            result.version = get_parameter_version(obj);
+            if (result.version != 0 && selected == selected_tuple && !if_none_match_str.empty() &&
+                if_none_match(if_none_match_str, make_etag(result.version, etag_suffixes[selected]))) {
+                result.not_modified = true;
+                return result;
+            }
+
+            result.value = get_parameter(obj);
+            return result;
+        },
+        [this, if_none_match_str, selected, selected_tuple](parameter_read result) {
+            const std::size_t representation =
+                std::holds_alternative<tuple_t>(result.value) ? selected_tuple : selected;
+
+            response resp        = response::stock_response(response::status_code::ok);
+            resp.headers["Vary"] = "Accept";
+
+            if (result.version != 0) {
+                auto etag = make_etag(result.version, etag_suffixes[representation]);
+                if (!result.not_modified && !if_none_match_str.empty())
+                    result.not_modified = if_none_match(if_none_match_str, etag);
+                resp.headers["ETag"] = std::move(etag);
+            }
+
+            if (result.not_modified) {
+                resp.status = response::status_code::not_modified;
+                send_response(std::move(resp));
+            } else
+                send_value_response(std::move(resp), result.value, representation);
+        });
+}
+
+void scgi_context::send_value_response(response resp, const value_t& value, std::size_t selected)
+{
+    if (selected == json_representation) {
+        resp.headers["Content-Type"] = std::string(json_content_type);
+
+        json_value_encoder encoder(resp.body);
+        std::visit(encoder, value);
+    } else if (selected == cbor_representation) {
+        resp.headers["Content-Type"] = std::string(cbor_content_type);
+
+        cbor_value_encoder encoder(resp.body);
+        std::visit(encoder, value);
+    } else if (selected == tuple_representation) {
+        resp.headers["Content-Type"] = std::string(tuple_content_type);
+
+        binary::encoder encoder(resp.body);
+        encoder(value);
+    } else if (handle_range_request(resp, value)) {
+        return;
+    } else {
+        std::ostringstream body_oss;
         std::visit(js_value_encoder(body_oss), value);
+        resp.body = body_oss.str();
     }
 
-    resp.body = std::move(body_oss.str());
-    send_response(resp);
+    send_response(std::move(resp));
+}
+
+bool scgi_context::handle_range_request(response& resp, const value_t& value)
+{
+    // Ranges are supported for string, binary and sequence values
+    auto length = range_encoded_size(value);
+    if (!length)
+        return false;
+
+    resp.headers["Accept-Ranges"] = "bytes";
+
+    // Without an entity tag no If-Range validator matches
+    auto range_value    = parser_.headers.find("HTTP_RANGE");
+    auto if_range_value = parser_.headers.find("HTTP_IF_RANGE");
+    if (range_value == nullptr)
+        return false;
+
+    if (if_range_value != nullptr) {
+        auto etag = resp.headers.find("ETag");
+        if (etag == resp.headers.end() || *if_range_value != etag->second)
+            return false;
+    }
+
+    byte_range range;
+    switch (parse_range(*range_value, *length, range)) {
+        case range_result::satisfiable:
+            resp.status                   = response::status_code::partial_content;
+            resp.headers["Content-Range"] = "bytes " + std::to_string(range.first) + "-" +
+                std::to_string(range.last) + "/" + std::to_string(*length);
+            resp.body = encode_range(value, range);
+            break;
+        case range_result::unsatisfiable:
+            resp.status                   = response::status_code::unsatisfiable_range;
+            resp.headers["Content-Range"] = "bytes */" + std::to_string(*length);
+            break;
+        case range_result::ignore:
+            return false;
+    }
+
+    send_response(std::move(resp));
+    return true;
+}
+
+void scgi_context::handle_browse_request()
+{
+    statistics::count_request(request_type::browse);
+
+    auto if_none_match_value = parser_.headers.find("HTTP_IF_NONE_MATCH");
+    auto if_none_match_str   = if_none_match_value != nullptr ? std::string(*if_none_match_value) : std::string();
+
+    access_dictionary(
+        [this]() {
+            return browse_cache_.get(&object_dictionary_, effective_userlevel(), [this]() {
+                std::ostringstream xml_oss;
+                {
+                    xml_visitor visitor(xml_oss);
+                    browse_object(&object_dictionary_, &visitor);
+                }
+                return xml_oss.str();
+            });
+        },
+        [this, if_none_match_str](browse_cache::entry cached) {
+            response resp = response::stock_response(response::status_code::ok);
+
+            if (!if_none_match_str.empty() && if_none_match(if_none_match_str, cached.etag))
+                resp.status = response::status_code::not_modified;
+            else
+                resp.shared_body = std::move(cached.content);
+
+            resp.headers["Content-Type"] = "text/xml";
+            resp.headers["ETag"]         = std::move(cached.etag);
+            send_response(std::move(resp));
+        });
 }
 
 void scgi_context::handle_put_request()
 {
+    statistics::count_request(request_type::set);
+
     std::string str;
     value_t     val;
     sequence_t  seq;
 
-    boost::algorithm::trim_if(parser_.body, boost::is_space());
-    std::istringstream ss(parser_.body);
+    // Binary encoded bodies must be taken as they are
+    const bool binary_body = parser_.content_type == "vnd/com.toptica.decof.boolean_seq" ||
+        parser_.content_type == "vnd/com.toptica.decof.integer_seq" ||
+        parser_.content_type == "vnd/com.toptica.decof.real_seq" || parser_.content_type == tuple_content_type;
+
+    if (!binary_body)
+        boost::algorithm::trim_if(parser_.body, boost::is_space());
 
     try {
         if (parser_.content_type == "vnd/com.toptica.decof.boolean") {
@@ -134,9 +467,11 @@ void scgi_context::handle_put_request()
             else
                 throw invalid_value_error();
         } else if (parser_.content_type == "vnd/com.toptica.decof.integer") {
+            std::istringstream ss(parser_.body);
             ss >> str;
             val = boost::lexical_cast<integer_t>(str);
         } else if (parser_.content_type == "vnd/com.toptica.decof.real") {
+            std::istringstream ss(parser_.body);
             ss >> str;
             val = boost::lexical_cast<real_t>(str);
         } else if (parser_.content_type == "vnd/com.toptica.decof.string") {
@@ -181,38 +516,276 @@ void scgi_context::handle_put_request()
             }
 
             val = std::move(seq);
-        } else if (parser_.content_type == "vnd/com.toptica.decof.tuple")
-            throw not_implemented_error();
-        else
+        } else if (parser_.content_type == tuple_content_type) {
+            binary::decoder decoder(parser_.body.data(), parser_.body.data() + parser_.body.size());
+            val = decoder.value();
+
+            const char* body_end = parser_.body.data() + parser_.body.size();
+            if (!std::holds_alternative<tuple_t>(val) || decoder.position() != body_end)
+                throw invalid_value_error();
+        } else
             throw wrong_type_error();
     } catch (boost::bad_lexical_cast&) {
         throw invalid_value_error();
     }
 
-    set_parameter(object_dictionary_.find_object(parser_.uri, '/'), val);
-    send_response(response::stock_response(response::status_code::ok));
+    access_dictionary(
+        [this, uri = std::string(parser_.uri), val = std::move(val)]() {
+            set_parameter(object_dictionary_.find_object(uri, '/'), val);
+            return true;
+        },
+        [this](bool) { send_response(response::stock_response(response::status_code::ok)); });
 }
 
 void scgi_context::handle_post_request()
 {
-    signal_event(object_dictionary_.find_object(parser_.uri, '/'));
-    send_response(response::stock_response(response::status_code::ok));
+    if (parser_.uri == batch_path) {
+        handle_batch_request(batch_uris_from_body(parser_.body));
+        return;
+    }
+
+    statistics::count_request(request_type::signal);
+
+    access_dictionary(
+        [this, uri = std::string(parser_.uri)]() {
+            signal_event(object_dictionary_.find_object(uri, '/'));
+            return true;
+        },
+        [this](bool) { send_response(response::stock_response(response::status_code::ok)); });
 }
 
-void scgi_context::send_response(const response& resp)
+void scgi_context::handle_batch_request(const std::vector<std::string>& uris)
 {
-    std::ostream out(&outbuf_);
-    out << resp;
+    // Item URIs are echoed in part headers
+    for (const auto& uri : uris) {
+        if (uri.find_first_of("\r\n") != std::string::npos)
+            throw parse_error();
+    }
+
+    statistics::count_request(request_type::get);
+
+    access_dictionary(
+        [this, uris]() {
+            std::vector<batch_read> reads(uris.size());
+
+            for (std::size_t i = 0; i < uris.size(); ++i) {
+                auto& [item, value] = reads[i];
+                item.uri            = uris[i];
+
+                try {
+                    auto obj = object_dictionary_.find_object(item.uri, '/');
+                    if (auto version = get_parameter_version(obj); version != 0)
+                        item.etag = make_etag(version);
+
+                    value = get_parameter(obj);
+                } catch (access_denied_error&) {
+                    item.status = response::status_code::unauthorized;
+                } catch (invalid_parameter_error&) {
+                    item.status = response::status_code::not_found;
+                } catch (runtime_error&) {
+                    item.status = response::status_code::bad_request;
+                }
+            }
+
+            return reads;
+        },
+        [this](std::vector<batch_read> reads) {
+            std::vector<batch_item> items;
+            std::ostringstream      body_oss;
+
+            items.reserve(reads.size());
+            for (auto& [item, value] : reads) {
+                if (item.status == response::status_code::ok) {
+                    body_oss.str(std::string());
+                    std::visit(js_value_encoder(body_oss), value);
+                    item.body = body_oss.str();
+                }
+
+                items.push_back(std::move(item));
+            }
+
+            std::string boundary;
+            response    resp = response::stock_response(response::status_code::ok);
+            resp.body        = encode_multipart(items, boundary);
+
+            resp.headers["Content-Type"] = "multipart/mixed; boundary=" + boundary;
+            send_response(std::move(resp));
+        });
+}
+
+void scgi_context::handle_heat_request(std::string_view query)
+{
+    statistics::count_request(request_type::tree);
+
+    access_dictionary(
+        [this, query = heat_query(query)]() { return heat_report(query.first, query.second); },
+        [this](std::vector<heat_map::record> records) {
+            using std::chrono::duration_cast;
+            using std::chrono::microseconds;
+
+            response           resp = response::stock_response(response::status_code::ok);
+            json_value_encoder encoder(resp.body);
+
+            resp.body = "[";
+            for (auto& record : records) {
+                const auto& values = record.values;
+
+                // Report the URI in the same form as with event streams
+                std::replace(record.uri.begin(), record.uri.end(), ':', '/');
+
+                resp.body += resp.body.size() > 1 ? ",{\"uri\":" : "{\"uri\":";
+                encoder(string_t{"/" + record.uri});
+                resp.body += ",\"reads\":";
+                encoder(static_cast<integer_t>(values.reads));
+                resp.body += ",\"read-time\":";
+                encoder(static_cast<integer_t>(duration_cast<microseconds>(values.read_time).count()));
+                resp.body += ",\"writes\":";
+                encoder(static_cast<integer_t>(values.writes));
+                resp.body += ",\"write-time\":";
+                encoder(static_cast<integer_t>(duration_cast<microseconds>(values.write_time).count()));
+                resp.body += ",\"observes\":";
+                encoder(static_cast<integer_t>(values.observes));
+                resp.body += ",\"emits\":";
+                encoder(static_cast<integer_t>(values.emits));
+                resp.body += "}";
+            }
+            resp.body += "]";
+
+            resp.headers["Content-Type"] = std::string(json_content_type);
+            send_response(std::move(resp));
+        });
+}
+
+void scgi_context::handle_event_stream_request(const std::vector<std::string>& uris)
+{
+    if (uris.empty())
+        throw invalid_parameter_error();
+
+    statistics::count_request(request_type::subscribe);
+
+    access_dictionary(
+        [this, uris]() {
+            // Check all objects before the stream is started
+            std::vector<object*> objs;
+            for (const auto& uri : uris) {
+                auto obj = object_dictionary_.find_object(uri, '/');
+                get_parameter_version(obj);
+                if (dynamic_cast<node*>(obj) == nullptr && dynamic_cast<client_observe_interface*>(obj) == nullptr)
+                    throw invalid_parameter_error();
+                objs.push_back(obj);
+            }
+
+            // Initial values are queued until the stream is started
+            try {
+                for (auto obj : objs)
+                    observe_subtree(
+                        obj, std::bind(&scgi_context::notify, this, std::placeholders::_1, std::placeholders::_2));
+            } catch (...) {
+                unobserve_all();
+                throw;
+            }
+
+            return true;
+        },
+        [this](bool) {
+            boost::asio::socket_base::send_buffer_size option;
+            socket_.get_option(option);
+            socket_send_buf_size_ = option.value();
+
+            response resp                 = response::stock_response(response::status_code::ok);
+            resp.headers["Content-Type"]  = "text/event-stream";
+            resp.headers["Cache-Control"] = "no-cache";
+            resp.unbounded_body           = true;
+            resp.serialize(outbuf_, header_buf_);
+            record_latency();
+
+            streaming_ = true;
+            preload_writing();
+            await_close();
+        });
+}
+
+void scgi_context::notify(const std::string& uri, const value_t& value)
+{
+    if (pending_updates_.push(uri, value)) {
+        auto self = shared_from_this();
+        flush_scheduler_.schedule(strand_, [self]() { self->preload_writing(); });
+    }
+}
+
+void scgi_context::preload_writing()
+{
+    if (!streaming_ || writing_active_ || !socket_.is_open())
+        return;
+
+    // Coalesced updates are only taken as long as the socket can take them
+    cli::update_queue::update update;
+    while (outbuf_.size() < socket_send_buf_size_ && pending_updates_.pop_front(update)) {
+        auto& [uri, value, time] = update;
+
+        // Report the URI in the same form as requested
+        std::replace(uri.begin(), uri.end(), ':', '/');
+
+        event_buf_.clear();
+        json_value_encoder encoder(event_buf_);
+        event_buf_ += "data: {\"uri\":";
+        encoder(string_t{"/" + uri});
+        event_buf_ += ",\"value\":";
+        std::visit(encoder, value);
+        event_buf_ += "}\n\n";
+        outbuf_.append(std::string_view(event_buf_));
+    }
+
+    if (outbuf_.empty())
+        return;
+
+    auto self = shared_from_this();
+    boost::asio::async_write(socket_, outbuf_.data(), strand_.wrap([self](const error_code& err, std::size_t bytes) {
+        self->write_handler(err, bytes);
+    }));
+
+    writing_active_ = true;
+}
+
+void scgi_context::await_close()
+{
+    auto self = shared_from_this();
+    socket_.async_read_some(boost::asio::buffer(inbuf_), strand_.wrap([self](const error_code& err, std::size_t) {
+        if (err)
+            self->disconnect();
+        else
+            self->await_close();
+    }));
+}
+
+void scgi_context::send_response(response resp)
+{
+    resp.serialize(outbuf_, header_buf_);
+    record_latency();
 
     auto self = shared_from_this();
-    boost::asio::async_write(socket_, outbuf_, strand_.wrap([self](const error_code& err, std::size_t bytes) {
+    boost::asio::async_write(socket_, outbuf_.data(), strand_.wrap([self](const error_code& err, std::size_t bytes) {
         self->write_handler(err, bytes);
     }));
 }
 
-void scgi_context::write_handler(const error_code& error, std::size_t)
+void scgi_context::record_latency()
 {
-    if (!error)
+    if (request_received_) {
+        statistics::record_latency(std::chrono::steady_clock::now() - *request_received_);
+        request_received_.reset();
+    }
+}
+
+void scgi_context::write_handler(const error_code& error, std::size_t bytes_transferred)
+{
+    outbuf_.consume(bytes_transferred);
+    statistics::count_bytes_out(protocol_type::scgi, bytes_transferred);
+
+    if (!error && streaming_) {
+        writing_active_ = false;
+        preload_writing();
+    } else if (!error && !disconnect_after_write_)
         preload();
     else
         disconnect();
@@ -220,8 +793,16 @@ void scgi_context::write_handler(const error_code& error, std::size_t)
 
 void scgi_context::disconnect()
 {
+    // Observations belong to the object dictionary strand
+    if (streaming_) {
+        streaming_ = false;
+
+        auto self = shared_from_this();
+        dictionary_strand_.post([self]() { self->unobserve_all(); });
+    }
+
     error_code ec;
-    socket_.shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+    socket_.shutdown(socket_t::shutdown_both, ec);
     socket_.close(ec);
 }
 
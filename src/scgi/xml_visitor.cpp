@@ -18,32 +18,40 @@
 #include <decof/client_write_interface.h>
 #include <decof/event.h>
 #include <decof/node.h>
-#include <map>
-#include <sstream>
+#include <cstdint>
+#include <cstdio>
+#include <string>
 
 namespace {
 
 std::string node_type_str(decof::node* node)
 {
-    std::stringstream ss;
-    ss << node->name() << std::hex << std::uppercase << node;
-    return ss.str();
-}
-
-std::string userlevel_name(decof::userlevel_t ul)
-{
-    static const std::map<decof::userlevel_t, const char*> userlevel_names = {{decof::Internal, "internal"},
-                                                                              {decof::Service, "service"},
-                                                                              {decof::Maintenance, "maintenance"},
-                                                                              {decof::Normal, "normal"},
-                                                                              {decof::Readonly, "readonly"}};
-
-    try {
-        return userlevel_names.at(ul);
-    } catch (std::out_of_range&) {
+    // Same format as streaming the pointer
+    char buf[2 * sizeof(void*) + 3];
+    int  n = std::snprintf(
+        buf, sizeof(buf), "0x%llx", static_cast<unsigned long long>(reinterpret_cast<std::uintptr_t>(node)));
+
+    std::string retval(node->name());
+    retval.append(buf, n);
+    return retval;
+}
+
+const char* userlevel_name(decof::userlevel_t ul)
+{
+    switch (ul) {
+    case decof::Internal:
+        return "internal";
+    case decof::Service:
+        return "service";
+    case decof::Maintenance:
+        return "maintenance";
+    case decof::Normal:
+        return "normal";
+    case decof::Readonly:
+        return "readonly";
+    default:
+        return "invalid";
     }
-
-    return "invalid";
 }
 
 } // Anonymous namespace
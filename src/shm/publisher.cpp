@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <decof/binary/codec.h>
+#include <decof/exceptions.h>
+#include <decof/object_dictionary.h>
+#include <decof/shm/publisher.h>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <functional>
+#include <limits>
+#include <new>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace {
+
+/// Rounds @a value up to the next power of two.
+std::size_t round_up_pow2(std::size_t value)
+{
+    std::size_t retval = 1;
+    while (retval < value)
+        retval <<= 1;
+    return retval;
+}
+
+/// Rounds @a value up to the record alignment.
+std::size_t align_record(std::size_t value)
+{
+    return (value + decof::shm::record_alignment - 1) / decof::shm::record_alignment * decof::shm::record_alignment;
+}
+
+[[noreturn]] void throw_system_error(const char* what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+/// Creates a shared memory of @a size bytes, maps it writable and applies
+/// @a seals. Returns the file descriptor.
+int create_shared_memory(const char* name, std::size_t size, int seals, void*& mapping)
+{
+    int fd = ::memfd_create(name, MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    if (fd < 0)
+        throw_system_error("memfd_create");
+
+    if (::ftruncate(fd, size) != 0) {
+        ::close(fd);
+        throw_system_error("ftruncate");
+    }
+
+    mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED) {
+        ::close(fd);
+        throw_system_error("mmap");
+    }
+
+    if (::fcntl(fd, F_ADD_SEALS, seals) != 0) {
+        const int error = errno;
+        ::munmap(mapping, size);
+        ::close(fd);
+        throw std::system_error(error, std::generic_category(), "fcntl");
+    }
+
+    return fd;
+}
+
+/// Writes a record consisting of header, URI and encoded value to @a out.
+void copy_record(char* out, const decof::shm::record_header& rec, const std::string& uri, const std::string& value)
+{
+    std::memcpy(out, &rec, sizeof(rec));
+    std::memcpy(out + sizeof(rec), uri.data(), uri.size());
+    std::memcpy(out + sizeof(rec) + uri.size(), value.data(), value.size());
+}
+
+/// Returns the current time in nanoseconds since epoch.
+std::int64_t timestamp()
+{
+    const auto now = std::chrono::system_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+} // Anonymous namespace
+
+namespace decof {
+
+namespace shm {
+
+publisher::publisher(
+    object_dictionary& od, strand_t& strand, const endpoint_type& endpoint, std::size_t capacity, userlevel_t userlevel)
+  : client_context(od, userlevel),
+    strand_(strand),
+    acceptor_(strand.context(), endpoint),
+    socket_(strand.context())
+{
+    capacity      = round_up_pow2(std::max<std::size_t>(capacity, 4096));
+    mapping_size_ = data_offset() + capacity;
+
+    // Subscribers can neither resize the shared memories nor map the ring
+    // writable
+    void* mapping;
+    memfd_ = create_shared_memory(
+        "decof2-shm", mapping_size_, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_FUTURE_WRITE, mapping);
+
+    void* consumers;
+    try {
+        consumers_memfd_ = create_shared_memory(
+            "decof2-shm-consumers", sizeof(consumer_table), F_SEAL_SHRINK | F_SEAL_GROW, consumers);
+    } catch (...) {
+        ::munmap(mapping, mapping_size_);
+        ::close(memfd_);
+        throw;
+    }
+
+    // The memory is zero-initialized which is a valid state of the atomics
+    header_           = new (mapping) ring_header;
+    header_->magic    = ring_magic;
+    header_->version  = ring_version;
+    header_->capacity = capacity;
+    header_->head.store(0, std::memory_order_relaxed);
+    header_->reserve.store(0, std::memory_order_relaxed);
+
+    consumers_ = new (consumers) consumer_table;
+    for (auto& consumer : consumers_->consumers) {
+        consumer.in_use.store(0, std::memory_order_relaxed);
+        consumer.waiting.store(0, std::memory_order_relaxed);
+    }
+
+    data_ = static_cast<char*>(mapping) + data_offset();
+}
+
+publisher::~publisher()
+{
+    boost::system::error_code ec;
+    acceptor_.close(ec);
+
+    for (std::size_t i = 0; i < connections_.size(); ++i)
+        detach(i);
+
+    unobserve_all();
+
+    ::munmap(consumers_, sizeof(consumer_table));
+    ::close(consumers_memfd_);
+    ::munmap(header_, mapping_size_);
+    ::close(memfd_);
+}
+
+std::string publisher::connection_type() const
+{
+    return std::string("shm");
+}
+
+void publisher::preload()
+{
+    async_accept();
+}
+
+void publisher::publish(const std::string& uri)
+{
+    auto obj = object_dictionary_.find_object(uri);
+    if (obj == nullptr)
+        throw invalid_parameter_error();
+
+    observe_subtree(obj, std::bind(&publisher::notify, this, std::placeholders::_1, std::placeholders::_2));
+    published_uris_.push_back(uri);
+}
+
+void publisher::unpublish(const std::string& uri)
+{
+    auto it = std::find(published_uris_.begin(), published_uris_.end(), uri);
+    if (it == published_uris_.end())
+        throw not_subscribed_error();
+
+    published_uris_.erase(it);
+    unobserve_subtree(object_dictionary_.find_object(uri));
+}
+
+std::uint64_t publisher::dropped() const noexcept
+{
+    return dropped_;
+}
+
+void publisher::async_accept()
+{
+    acceptor_.async_accept(socket_, strand_.wrap(std::bind(&publisher::accept_handler, this, std::placeholders::_1)));
+}
+
+void publisher::accept_handler(const boost::system::error_code& error)
+{
+    if (!acceptor_.is_open())
+        return;
+
+    if (!error)
+        attach(std::move(socket_));
+
+    async_accept();
+}
+
+void publisher::attach(boost::asio::local::stream_protocol::socket socket)
+{
+    auto it = std::find_if(
+        connections_.begin(), connections_.end(), [](const connection& conn) { return conn.socket == nullptr; });
+    if (it == connections_.end())
+        return;
+
+    const std::size_t slot = it - connections_.begin();
+
+    // The current values are sent to the new subscriber only
+    auto records = std::make_shared<std::string>(snapshot());
+    if (records->size() > std::numeric_limits<std::uint32_t>::max())
+        return;
+
+    int eventfd = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (eventfd < 0)
+        return;
+
+    handshake hs{static_cast<std::uint32_t>(slot),
+                 static_cast<std::uint32_t>(records->size()),
+                 header_->head.load(std::memory_order_relaxed),
+                 sequence_ + 1};
+
+    // The shared memories and the eventfd are passed along with the handshake
+    int  fds[3] = {memfd_, consumers_memfd_, eventfd};
+    char control[CMSG_SPACE(sizeof(fds))];
+    std::memset(control, 0, sizeof(control));
+
+    iovec  iov{&hs, sizeof(hs)};
+    msghdr msg{};
+    msg.msg_iov        = &iov;
+    msg.msg_iovlen     = 1;
+    msg.msg_control    = control;
+    msg.msg_controllen = sizeof(control);
+
+    cmsghdr* cmsg    = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type  = SCM_RIGHTS;
+    cmsg->cmsg_len   = CMSG_LEN(sizeof(fds));
+    std::memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+    if (::sendmsg(socket.native_handle(), &msg, MSG_NOSIGNAL) != sizeof(hs)) {
+        ::close(eventfd);
+        return;
+    }
+
+    consumers_->consumers[slot].waiting.store(0, std::memory_order_relaxed);
+    consumers_->consumers[slot].in_use.store(1, std::memory_order_release);
+
+    it->socket  = std::make_unique<boost::asio::local::stream_protocol::socket>(std::move(socket));
+    it->eventfd = eventfd;
+
+    // Subscribers never send anything, so reading detects disconnection. The
+    // slot may already be reassigned when a detach aborted the read.
+    boost::asio::async_read(
+        *it->socket,
+        boost::asio::buffer(&it->dummy, 1),
+        strand_.wrap([this, slot](const boost::system::error_code& error, std::size_t) {
+            if (error != boost::asio::error::operation_aborted)
+                detach(slot);
+        }));
+
+    boost::asio::async_write(
+        *it->socket,
+        boost::asio::buffer(*records),
+        strand_.wrap([records](const boost::system::error_code&, std::size_t) {}));
+}
+
+void publisher::detach(std::size_t slot)
+{
+    auto& conn = connections_[slot];
+    if (conn.socket == nullptr)
+        return;
+
+    consumers_->consumers[slot].in_use.store(0, std::memory_order_release);
+
+    boost::system::error_code ec;
+    conn.socket->close(ec);
+    conn.socket.reset();
+
+    ::close(conn.eventfd);
+    conn.eventfd = -1;
+}
+
+void publisher::notify(const std::string& uri, const value_t& value)
+{
+    write_record(uri, value);
+}
+
+std::size_t publisher::encode_record(const std::string& uri, const value_t& value)
+{
+    value_buf_.clear();
+    binary::encoder encoder(value_buf_);
+    encoder(value);
+
+    return align_record(sizeof(record_header) + uri.size() + value_buf_.size());
+}
+
+void publisher::write_record(const std::string& uri, const value_t& value)
+{
+    const std::uint64_t capacity = header_->capacity;
+    const std::size_t   size     = encode_record(uri, value);
+    if (size > capacity / 4) {
+        ++dropped_;
+        return;
+    }
+
+    // Records never wrap around the end of the data area
+    const std::uint64_t head    = header_->head.load(std::memory_order_relaxed);
+    std::uint64_t       pos     = head;
+    std::size_t         offset  = pos & (capacity - 1);
+    const std::size_t   padding = offset + size > capacity ? capacity - offset : 0;
+
+    header_->reserve.store(head + padding + size, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    if (padding >= sizeof(record_header)) {
+        record_header pad{static_cast<std::uint32_t>(padding), padding_record, 0, 0};
+        std::memcpy(data_ + offset, &pad, sizeof(pad));
+    }
+    pos += padding;
+    offset = pos & (capacity - 1);
+
+    record_header rec{
+        static_cast<std::uint32_t>(size), static_cast<std::uint32_t>(uri.size()), ++sequence_, timestamp()};
+    copy_record(data_ + offset, rec, uri, value_buf_);
+
+    header_->head.store(pos + size, std::memory_order_release);
+
+    // Subscribers announce waiting before checking the head position again
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (std::size_t i = 0; i < connections_.size(); ++i) {
+        auto& consumer = consumers_->consumers[i];
+        if (connections_[i].eventfd < 0 || consumer.waiting.load(std::memory_order_relaxed) == 0)
+            continue;
+
+        if (consumer.waiting.exchange(0, std::memory_order_relaxed) != 0) {
+            const std::uint64_t   one     = 1;
+            [[maybe_unused]] auto written = ::write(connections_[i].eventfd, &one, sizeof(one));
+        }
+    }
+}
+
+std::string publisher::snapshot()
+{
+    std::string retval;
+
+    auto append = [&](object* obj) {
+        const std::string uri    = obj->fq_name();
+        const std::size_t size   = encode_record(uri, get_parameter(obj));
+        const std::size_t offset = retval.size();
+
+        record_header rec{static_cast<std::uint32_t>(size), static_cast<std::uint32_t>(uri.size()), 0, timestamp()};
+        retval.resize(offset + size);
+        copy_record(&retval[offset], rec, uri, value_buf_);
+    };
+
+    for (const auto& uri : published_uris_) {
+        try {
+            for_each_observable(object_dictionary_.find_object(uri), append);
+        } catch (runtime_error&) {
+        }
+    }
+
+    return retval;
+}
+
+} // namespace shm
+
+} // namespace decof
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <decof/binary/codec.h>
+#include <decof/exceptions.h>
+#include <decof/shm/subscriber.h>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace {
+
+[[noreturn]] void throw_system_error(const char* what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+/// Decodes the URI and value of a record from @a body.
+void decode_record(const decof::shm::record_header& header,
+                   const char*                      body,
+                   std::size_t                      size,
+                   decof::shm::subscriber::record&  rec)
+{
+    decof::binary::decoder decoder(body + header.uri_size, body + size);
+    rec.uri.assign(body, header.uri_size);
+    rec.value    = decoder.value();
+    rec.sequence = header.sequence;
+    rec.time     = std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(header.timestamp)));
+}
+
+} // Anonymous namespace
+
+namespace decof {
+
+namespace shm {
+
+subscriber::subscriber(const std::string& path)
+{
+    sockaddr_un addr{};
+    if (path.empty() || path.size() >= sizeof(addr.sun_path))
+        throw std::system_error(std::make_error_code(std::errc::invalid_argument), "path");
+
+    addr.sun_family = AF_UNIX;
+    std::memcpy(addr.sun_path, path.data(), path.size());
+
+    // Abstract names are not null-terminated
+    socklen_t addr_len = offsetof(sockaddr_un, sun_path) + path.size() + (path[0] != '\0' ? 1 : 0);
+
+    socket_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (socket_ < 0)
+        throw_system_error("socket");
+
+    int  fds[3] = {-1, -1, -1};
+    auto fail   = [&](const char* what) {
+        const int error = errno;
+        for (int fd : fds) {
+            if (fd >= 0)
+                ::close(fd);
+        }
+        ::close(socket_);
+        throw std::system_error(error, std::generic_category(), what);
+    };
+
+    if (::connect(socket_, reinterpret_cast<sockaddr*>(&addr), addr_len) != 0)
+        fail("connect");
+
+    // Receive the handshake along with the shared memories and eventfd
+    handshake hs;
+    char      control[CMSG_SPACE(sizeof(fds))];
+    iovec     iov{&hs, sizeof(hs)};
+    msghdr    msg{};
+    msg.msg_iov        = &iov;
+    msg.msg_iovlen     = 1;
+    msg.msg_control    = control;
+    msg.msg_controllen = sizeof(control);
+
+    // The publisher closes the connection if all consumer slots are in use
+    const ssize_t received = ::recvmsg(socket_, &msg, MSG_CMSG_CLOEXEC | MSG_WAITALL);
+    if (received == 0)
+        errno = ECONNREFUSED;
+    if (received != sizeof(hs))
+        fail("recvmsg");
+
+    cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+    if (cmsg == nullptr || cmsg->cmsg_type != SCM_RIGHTS || cmsg->cmsg_len != CMSG_LEN(sizeof(fds))) {
+        errno = EPROTO;
+        fail("recvmsg");
+    }
+    std::memcpy(fds, CMSG_DATA(cmsg), sizeof(fds));
+
+    struct stat st;
+    if (::fstat(fds[0], &st) != 0)
+        fail("fstat");
+    mapping_size_ = st.st_size;
+
+    if (::fstat(fds[1], &st) != 0)
+        fail("fstat");
+    if (static_cast<std::size_t>(st.st_size) < sizeof(consumer_table) || hs.slot >= max_consumers) {
+        errno = EPROTO;
+        fail("handshake");
+    }
+
+    void* mapping = ::mmap(nullptr, mapping_size_, PROT_READ, MAP_SHARED, fds[0], 0);
+    if (mapping == MAP_FAILED)
+        fail("mmap");
+
+    header_ = static_cast<const ring_header*>(mapping);
+    if (mapping_size_ < data_offset() || header_->magic != ring_magic || header_->version != ring_version ||
+        header_->capacity != mapping_size_ - data_offset()) {
+        ::munmap(mapping, mapping_size_);
+        errno = EPROTO;
+        fail("handshake");
+    }
+
+    // Only the consumer slots are writable for announcing waits
+    void* consumers = ::mmap(nullptr, sizeof(consumer_table), PROT_READ | PROT_WRITE, MAP_SHARED, fds[1], 0);
+    if (consumers == MAP_FAILED) {
+        const int error = errno;
+        ::munmap(mapping, mapping_size_);
+        errno = error;
+        fail("mmap");
+    }
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+    eventfd_       = fds[2];
+    consumers_     = static_cast<consumer_table*>(consumers);
+    data_          = static_cast<const char*>(mapping) + data_offset();
+    slot_          = hs.slot;
+    position_      = hs.start;
+    next_sequence_ = hs.sequence;
+
+    try {
+        receive_snapshot(hs.snapshot_size);
+    } catch (...) {
+        ::munmap(consumers, sizeof(consumer_table));
+        ::munmap(mapping, mapping_size_);
+        ::close(eventfd_);
+        ::close(socket_);
+        throw;
+    }
+}
+
+subscriber::~subscriber()
+{
+    ::munmap(consumers_, sizeof(consumer_table));
+    ::munmap(const_cast<ring_header*>(header_), mapping_size_);
+    ::close(eventfd_);
+    ::close(socket_);
+}
+
+void subscriber::receive_snapshot(std::size_t size)
+{
+    std::string buf(size, '\0');
+    for (std::size_t pos = 0; pos < size;) {
+        const ssize_t received = ::recv(socket_, &buf[pos], size - pos, MSG_WAITALL);
+        if (received == 0)
+            errno = ECONNRESET;
+        if (received <= 0 && errno != EINTR)
+            throw_system_error("recv");
+        if (received > 0)
+            pos += received;
+    }
+
+    for (std::size_t pos = 0; pos < size;) {
+        record_header header;
+        if (size - pos < sizeof(header))
+            throw invalid_value_error();
+        std::memcpy(&header, buf.data() + pos, sizeof(header));
+
+        if (header.size < sizeof(header) || header.size > size - pos ||
+            header.uri_size > header.size - sizeof(header))
+            throw invalid_value_error();
+
+        record rec;
+        decode_record(header, buf.data() + pos + sizeof(header), header.size - sizeof(header), rec);
+        snapshot_.push_back(std::move(rec));
+        pos += header.size;
+    }
+}
+
+bool subscriber::try_read(record& rec)
+{
+    if (!snapshot_.empty()) {
+        rec = std::move(snapshot_.front());
+        snapshot_.pop_front();
+        return true;
+    }
+
+    const std::uint64_t capacity = header_->capacity;
+
+    for (;;) {
+        const std::uint64_t head = header_->head.load(std::memory_order_acquire);
+        if (position_ == head)
+            return false;
+
+        // Overrun records are counted by the sequence number gap
+        if (head - position_ > capacity) {
+            position_ = head;
+            continue;
+        }
+
+        const std::size_t offset = position_ & (capacity - 1);
+        if (capacity - offset < sizeof(record_header)) {
+            position_ += capacity - offset;
+            continue;
+        }
+
+        record_header header;
+        std::memcpy(&header, data_ + offset, sizeof(header));
+
+        const bool padding = header.uri_size == padding_record;
+        const bool valid   = header.size >= sizeof(record_header) && header.size <= capacity - offset &&
+            header.size % record_alignment == 0 && (padding || header.uri_size <= header.size - sizeof(record_header));
+        if (valid && !padding)
+            record_buf_.assign(data_ + offset + sizeof(header), header.size - sizeof(header));
+
+        // Validate the copy against concurrent overwrites
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (header_->reserve.load(std::memory_order_relaxed) - position_ > capacity) {
+            position_ = header_->head.load(std::memory_order_acquire);
+            continue;
+        }
+
+        if (!valid)
+            throw invalid_value_error();
+
+        position_ += header.size;
+        if (padding)
+            continue;
+
+        if (header.sequence > next_sequence_)
+            lost_ += header.sequence - next_sequence_;
+        next_sequence_ = header.sequence + 1;
+
+        decode_record(header, record_buf_.data(), record_buf_.size(), rec);
+        return true;
+    }
+}
+
+bool subscriber::read(record& rec, std::chrono::milliseconds timeout)
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    auto&      consumer = consumers_->consumers[slot_];
+
+    while (!try_read(rec)) {
+        // Announce waiting before checking once more, see publisher
+        consumer.waiting.store(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (try_read(rec)) {
+            consumer.waiting.store(0, std::memory_order_relaxed);
+            return true;
+        }
+
+        const auto remaining =
+            std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+        if (remaining <= 0) {
+            consumer.waiting.store(0, std::memory_order_relaxed);
+            return false;
+        }
+
+        pollfd pfd{eventfd_, POLLIN, 0};
+        if (::poll(&pfd, 1, static_cast<int>(remaining)) < 0 && errno != EINTR)
+            throw_system_error("poll");
+
+        std::uint64_t counter;
+        if (::read(eventfd_, &counter, sizeof(counter)) < 0 && errno != EAGAIN)
+            throw_system_error("read");
+    }
+
+    return true;
+}
+
+std::uint64_t subscriber::lost() const noexcept
+{
+    return lost_;
+}
+
+int subscriber::native_handle() const noexcept
+{
+    return eventfd_;
+}
+
+} // namespace shm
+
+} // namespace decof
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <decof/binary/codec.h>
+#include <decof/exceptions.h>
+#include <decof/object_dictionary.h>
+#include <decof/udp/publisher.h>
+#include <boost/asio/ip/multicast.hpp>
+#include <boost/lexical_cast.hpp>
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <memory>
+
+namespace {
+
+/// Maximum UDP payload size over IPv4.
+const std::size_t max_udp_payload = 65507;
+
+} // Anonymous namespace
+
+namespace decof {
+
+namespace udp {
+
+publisher::publisher(object_dictionary& od, strand_t& strand, const endpoint_type& destination, userlevel_t userlevel)
+  : client_context(od, userlevel),
+    strand_(strand),
+    destination_(destination),
+    socket_(strand.context()),
+    alive_(std::make_shared<char>())
+{
+    socket_.open(destination.protocol());
+    if (destination.address().is_multicast()) {
+        socket_.set_option(boost::asio::ip::multicast::hops(1));
+        socket_.set_option(boost::asio::ip::multicast::enable_loopback(true));
+    }
+
+    datagram_.reserve(max_datagram_size_);
+}
+
+publisher::~publisher()
+{
+    flush();
+    unobserve_all();
+}
+
+std::string publisher::connection_type() const
+{
+    return std::string("udp");
+}
+
+std::string publisher::remote_endpoint() const
+{
+    return boost::lexical_cast<std::string>(destination_);
+}
+
+void publisher::batch_size(std::size_t size)
+{
+    batch_size_ = std::clamp<std::size_t>(size, 1, std::numeric_limits<std::uint16_t>::max());
+}
+
+void publisher::max_datagram_size(std::size_t size)
+{
+    max_datagram_size_ = std::min(size, max_udp_payload);
+}
+
+void publisher::announce_interval(std::size_t datagrams)
+{
+    announce_interval_ = datagrams;
+}
+
+void publisher::multicast_hops(int hops)
+{
+    socket_.set_option(boost::asio::ip::multicast::hops(hops));
+}
+
+void publisher::multicast_interface(const boost::asio::ip::address_v4& address)
+{
+    socket_.set_option(boost::asio::ip::multicast::outbound_interface(address));
+}
+
+void publisher::publish(const std::string& uri)
+{
+    auto obj = object_dictionary_.find_object(uri);
+    if (obj == nullptr)
+        throw invalid_parameter_error();
+
+    for_each_observable(obj, [this](object* param) {
+        // Receivers learn the id before the initial value
+        const auto uri = param->fq_name();
+        auto       it  = ids_.find(uri);
+        if (it == ids_.end())
+            it = ids_.emplace(uri, next_id_++).first;
+        append_record(record_kind::announce, it->second, announcement(uri));
+
+        observe(param, std::bind(&publisher::notify, this, std::placeholders::_1, std::placeholders::_2));
+    });
+}
+
+void publisher::unpublish(const std::string& uri)
+{
+    auto obj = object_dictionary_.find_object(uri);
+    if (obj == nullptr)
+        throw invalid_parameter_error();
+
+    unobserve_subtree(obj);
+    for_each_observable(obj, [this](object* param) { ids_.erase(param->fq_name()); });
+}
+
+void publisher::flush()
+{
+    flush_scheduled_ = false;
+    if (records_ == 0)
+        return;
+
+    // Complete the datagram header
+    datagram_[2] = static_cast<char>(records_ & 0xff);
+    datagram_[3] = static_cast<char>(records_ >> 8);
+
+    boost::system::error_code ec;
+    socket_.send_to(boost::asio::buffer(datagram_), destination_, 0, ec);
+    if (ec)
+        ++send_errors_;
+    else
+        ++sent_;
+
+    datagram_.clear();
+    records_ = 0;
+
+    if (announce_interval_ != 0 && !announcing_ && ++since_announcement_ >= announce_interval_) {
+        since_announcement_ = 0;
+        announcing_         = true;
+        announce_all();
+        flush();
+        announcing_ = false;
+    }
+}
+
+std::uint64_t publisher::sent() const noexcept
+{
+    return sent_;
+}
+
+std::uint64_t publisher::send_errors() const noexcept
+{
+    return send_errors_;
+}
+
+std::uint64_t publisher::dropped() const noexcept
+{
+    return dropped_;
+}
+
+void publisher::notify(const std::string& uri, const value_t& value)
+{
+    auto it = ids_.find(uri);
+    if (it == ids_.end())
+        return;
+
+    payload_.clear();
+    binary::encoder encoder(payload_);
+    encoder(value);
+
+    append_record(record_kind::value, it->second, payload_);
+}
+
+void publisher::append_record(record_kind kind, std::uint32_t id, const std::string& payload)
+{
+    const std::size_t record_size = record_header_size + payload.size();
+    if (datagram_header_size + record_size > max_datagram_size_) {
+        ++dropped_;
+        return;
+    }
+
+    if (records_ != 0 && datagram_.size() + record_size > max_datagram_size_)
+        flush();
+
+    if (records_ == 0) {
+        datagram_.push_back(static_cast<char>(datagram_version));
+        datagram_.push_back('\0');
+        write_le<std::uint16_t>(datagram_, 0);
+        write_le<std::uint64_t>(datagram_, sequence_++);
+    }
+
+    datagram_.push_back(static_cast<char>(kind));
+    write_le<std::uint32_t>(datagram_, id);
+    datagram_.append(payload);
+    ++records_;
+
+    // Changes emitted by the current handler are batched
+    if (records_ >= batch_size_ || datagram_.size() >= max_datagram_size_)
+        flush();
+    else if (!flush_scheduled_) {
+        flush_scheduled_ = true;
+        strand_.post([this, alive = std::weak_ptr<void>(alive_)]() {
+            if (!alive.expired() && flush_scheduled_)
+                flush();
+        });
+    }
+}
+
+void publisher::announce_all()
+{
+    for (const auto& elem : ids_)
+        append_record(record_kind::announce, elem.second, announcement(elem.first));
+}
+
+std::string publisher::announcement(const std::string& uri)
+{
+    std::string retval;
+    write_le<std::uint16_t>(retval, static_cast<std::uint16_t>(uri.size()));
+    retval.append(uri);
+    return retval;
+}
+
+} // namespace udp
+
+} // namespace decof
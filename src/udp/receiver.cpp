@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <decof/binary/codec.h>
+#include <decof/exceptions.h>
+#include <decof/udp/datagram.h>
+
+namespace decof {
+
+namespace udp {
+
+receiver::receiver(value_handler handler)
+  : handler_(std::move(handler))
+{
+}
+
+void receiver::receive(const char* data, std::size_t size)
+{
+    if (size < datagram_header_size || static_cast<std::uint8_t>(data[0]) != datagram_version)
+        throw invalid_value_error();
+
+    const auto count    = read_le<std::uint16_t>(data + 2);
+    const auto sequence = read_le<std::uint64_t>(data + 4);
+
+    // Datagrams arriving late are counted as lost, too
+    if (sequence != next_sequence_ && next_sequence_ != 0)
+        lost_ += sequence > next_sequence_ ? sequence - next_sequence_ : 1;
+    if (sequence >= next_sequence_)
+        next_sequence_ = sequence + 1;
+
+    const char* pos  = data + datagram_header_size;
+    const char* last = data + size;
+    for (std::uint16_t i = 0; i < count; ++i) {
+        if (last - pos < static_cast<std::ptrdiff_t>(record_header_size))
+            throw invalid_value_error();
+
+        const auto kind = static_cast<record_kind>(*pos);
+        const auto id   = read_le<std::uint32_t>(pos + 1);
+        pos += record_header_size;
+
+        if (kind == record_kind::announce) {
+            if (last - pos < 2)
+                throw invalid_value_error();
+
+            const auto length = read_le<std::uint16_t>(pos);
+            pos += 2;
+            if (last - pos < length)
+                throw invalid_value_error();
+
+            uris_[id].assign(pos, length);
+            pos += length;
+        } else if (kind == record_kind::value) {
+            binary::decoder decoder(pos, last);
+            value_t         value = decoder.value();
+            pos                   = decoder.position();
+
+            auto it = uris_.find(id);
+            if (it != uris_.end())
+                handler_(it->second, value);
+            else
+                ++unknown_;
+        } else
+            throw invalid_value_error();
+    }
+}
+
+std::uint64_t receiver::lost() const noexcept
+{
+    return lost_;
+}
+
+std::uint64_t receiver::unknown() const noexcept
+{
+    return unknown_;
+}
+
+} // namespace udp
+
+} // namespace decof
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+#define BOOST_THREAD_PROVIDES_EXECUTORS
+#define BOOST_THREAD_USES_MOVE
+
+#include <decof/asio_executor/asio_executor.h>
+#include <decof/asio_executor/thread_pool_executor.h>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/test/unit_test.hpp>
+#include <boost/thread/future.hpp>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(executors)
+
+using namespace decof;
+
+BOOST_AUTO_TEST_CASE(thread_pool_runs_all)
+{
+    const std::size_t    count = 1000;
+    std::atomic<int>     executed{0};
+    thread_pool_executor pool(2);
+
+    for (std::size_t i = 0; i < count; ++i)
+        pool.submit([&executed]() { ++executed; });
+
+    pool.close();
+    pool.join();
+
+    BOOST_REQUIRE_EQUAL(executed, count);
+
+    const auto metrics = pool.metrics();
+    BOOST_REQUIRE_EQUAL(metrics.executed, count);
+    BOOST_REQUIRE_EQUAL(metrics.queue_depth, 0u);
+    BOOST_REQUIRE(metrics.max_latency >= metrics.mean_latency);
+    BOOST_REQUIRE_THROW(pool.submit([]() {}), boost::sync_queue_is_closed);
+}
+
+BOOST_AUTO_TEST_CASE(thread_pool_steals_work)
+{
+    const int            count = 10;
+    std::atomic<int>     executed{0};
+    thread_pool_executor pool(2);
+
+    // Closures submitted by a busy worker can only be run by the other one
+    pool.submit([&]() {
+        for (int i = 0; i < count; ++i)
+            pool.submit([&executed]() { ++executed; });
+
+        while (executed < count)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    });
+
+    while (executed < count)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    pool.close();
+    pool.join();
+
+    BOOST_REQUIRE_EQUAL(executed, count);
+    BOOST_REQUIRE_GE(pool.metrics().stolen, static_cast<std::uint64_t>(count));
+}
+
+BOOST_AUTO_TEST_CASE(thread_pool_runs_submissions_in_order)
+{
+    const int            count = 10;
+    std::atomic<bool>    blocked{true};
+    std::vector<int>     order;
+    thread_pool_executor pool(1);
+
+    // Queue all closures while the only worker is busy
+    pool.submit([&blocked]() {
+        while (blocked)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    });
+
+    for (int i = 0; i < count; ++i)
+        pool.submit([&order, i]() { order.push_back(i); });
+
+    blocked = false;
+    pool.close();
+    pool.join();
+
+    BOOST_REQUIRE_EQUAL(order.size(), static_cast<std::size_t>(count));
+    for (int i = 0; i < count; ++i)
+        BOOST_REQUIRE_EQUAL(order[i], i);
+}
+
+BOOST_AUTO_TEST_CASE(continuation_on_strand)
+{
+    boost::asio::io_service         io_service;
+    boost::asio::io_service::strand strand(io_service);
+    asio_executor                   strand_executor(strand);
+    thread_pool_executor            pool(2);
+
+    std::thread::id continuation_thread;
+    auto            future = boost::async(pool, []() { return 21; });
+    auto            result = future.then(strand_executor, [&](boost::unique_future<int> f) {
+        continuation_thread = std::this_thread::get_id();
+        return f.get() * 2;
+    });
+
+    // The continuation is run by the thread running the I/O service
+    while (!result.is_ready()) {
+        io_service.reset();
+        io_service.poll();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    BOOST_REQUIRE_EQUAL(result.get(), 42);
+    BOOST_REQUIRE(continuation_thread == std::this_thread::get_id());
+    BOOST_REQUIRE_EQUAL(strand_executor.metrics().executed, 1u);
+    BOOST_REQUIRE_EQUAL(strand_executor.metrics().queue_depth, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(benchmark)
+{
+    const std::size_t count = 100000;
+
+    for (std::size_t threads = 1; threads <= std::max(1u, std::thread::hardware_concurrency()); threads *= 2) {
+        std::atomic<std::size_t> executed{0};
+        thread_pool_executor     pool(threads);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (std::size_t i = 0; i < count; ++i)
+            pool.submit([&executed]() { ++executed; });
+
+        pool.close();
+        pool.join();
+        auto duration = std::chrono::high_resolution_clock::now() - start;
+
+        const auto metrics = pool.metrics();
+        std::cout << "Executing " << count << " closures on " << threads << " worker thread(s) took "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() << " ms, mean latency "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(metrics.mean_latency).count()
+                  << " us, maximum latency "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(metrics.max_latency).count() << " us, "
+                  << metrics.stolen << " stolen" << std::endl;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <decof/binary/codec.h>
+#include <decof/binary/delta.h>
+#include <decof/exceptions.h>
+#include <boost/test/unit_test.hpp>
+#include <string>
+
+BOOST_AUTO_TEST_SUITE(binary_codec)
+
+using namespace decof;
+
+namespace {
+
+value_t round_trip(const value_t& value)
+{
+    std::string buf;
+    std::visit(binary::encoder(buf), value);
+
+    binary::decoder decoder(buf.data(), buf.data() + buf.size());
+    auto            retval = decoder.value();
+    BOOST_REQUIRE(decoder.position() == buf.data() + buf.size());
+
+    return retval;
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(scalars)
+{
+    const std::vector<value_t> values = {scalar_t(true),
+                                         scalar_t(integer_t(-1234567890123)),
+                                         scalar_t(real_t(3.14159)),
+                                         scalar_t(string_t("Hello, world")),
+                                         scalar_t(binary_t(std::string("\0\1\2", 3)))};
+
+    for (const auto& value : values)
+        BOOST_REQUIRE(round_trip(value) == value);
+}
+
+BOOST_AUTO_TEST_CASE(integer_encoding)
+{
+    std::string buf;
+    binary::encoder encoder(buf);
+    encoder(integer_t(0x0102030405060708));
+
+    BOOST_REQUIRE_EQUAL(buf, std::string("\x02\x08\x07\x06\x05\x04\x03\x02\x01", 9));
+}
+
+BOOST_AUTO_TEST_CASE(real_sequence_is_raw_array)
+{
+    sequence_t seq;
+    for (int i = 0; i < 100; ++i)
+        seq.push_back(real_t(i) / 3.0);
+
+    std::string buf;
+    binary::encoder encoder(buf);
+    encoder(seq);
+
+    BOOST_REQUIRE_EQUAL(buf.size(), 1u + 1u + 4u + 100u * 8u);
+    BOOST_REQUIRE(round_trip(seq) == value_t(seq));
+}
+
+BOOST_AUTO_TEST_CASE(sequences_and_tuples)
+{
+    BOOST_REQUIRE(round_trip(sequence_t{}) == value_t(sequence_t{}));
+    BOOST_REQUIRE(round_trip(sequence_t{true, false}) == value_t(sequence_t{true, false}));
+    BOOST_REQUIRE(
+        round_trip(sequence_t{string_t("a"), string_t("bc")}) == value_t(sequence_t{string_t("a"), string_t("bc")}));
+
+    const tuple_t tup{true, integer_t(1), real_t(2.0), string_t("three")};
+    BOOST_REQUIRE(round_trip(tup) == value_t(tup));
+}
+
+BOOST_AUTO_TEST_CASE(mixed_sequence)
+{
+    std::string buf;
+    binary::encoder encoder(buf);
+    BOOST_REQUIRE_THROW(encoder(sequence_t{true, integer_t(1)}), invalid_value_error);
+}
+
+BOOST_AUTO_TEST_CASE(truncated_input)
+{
+    std::string buf;
+    binary::encoder encoder(buf);
+    encoder(sequence_t{real_t(1.0), real_t(2.0)});
+
+    for (std::size_t size = 0; size < buf.size(); ++size) {
+        binary::decoder decoder(buf.data(), buf.data() + size);
+        BOOST_REQUIRE_THROW(decoder.value(), invalid_value_error);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(invalid_tag)
+{
+    const std::string buf("\x2a", 1);
+    binary::decoder   decoder(buf.data(), buf.data() + buf.size());
+    BOOST_REQUIRE_THROW(decoder.value(), invalid_value_error);
+}
+
+BOOST_AUTO_TEST_CASE(changed_ranges)
+{
+    std::vector<double> lhs(1000, 1.0), rhs(lhs);
+    rhs[3]   = 2.0;
+    rhs[4]   = 2.0;
+    rhs[500] = 2.0;
+    rhs[999] = 2.0;
+
+    const auto ranges = binary::changed_ranges(reinterpret_cast<const char*>(lhs.data()),
+                                               reinterpret_cast<const char*>(rhs.data()),
+                                               lhs.size(),
+                                               sizeof(double));
+
+    BOOST_REQUIRE_EQUAL(ranges.size(), 3u);
+    BOOST_REQUIRE(ranges[0] == binary::element_range(3, 2));
+    BOOST_REQUIRE(ranges[1] == binary::element_range(500, 1));
+    BOOST_REQUIRE(ranges[2] == binary::element_range(999, 1));
+}
+
+BOOST_AUTO_TEST_CASE(sequence_patch)
+{
+    sequence_t previous(10000, real_t(0.5));
+    sequence_t current(previous);
+    current[1234] = real_t(1.5);
+
+    std::string prev_enc, cur_enc;
+    binary::encoder prev_encoder(prev_enc);
+    binary::encoder cur_encoder(cur_enc);
+    prev_encoder(previous);
+    cur_encoder(current);
+
+    std::string patch;
+    BOOST_REQUIRE(binary::encode_patch(patch, prev_enc, cur_enc));
+    BOOST_REQUIRE_LT(patch.size(), 32u);
+
+    value_t value(previous);
+    binary::apply_patch(value, patch.data(), patch.data() + patch.size());
+    BOOST_REQUIRE(value == value_t(current));
+}
+
+BOOST_AUTO_TEST_CASE(binary_patch)
+{
+    const binary_t previous(std::string(4096, 'a'));
+    binary_t       current(previous);
+    current[0]    = 'b';
+    current[4095] = 'c';
+
+    std::string prev_enc, cur_enc;
+    binary::encoder prev_encoder(prev_enc);
+    binary::encoder cur_encoder(cur_enc);
+    prev_encoder(previous);
+    cur_encoder(current);
+
+    std::string patch;
+    BOOST_REQUIRE(binary::encode_patch(patch, prev_enc, cur_enc));
+
+    value_t value{scalar_t(previous)};
+    binary::apply_patch(value, patch.data(), patch.data() + patch.size());
+    BOOST_REQUIRE(value == value_t(scalar_t(current)));
+}
+
+BOOST_AUTO_TEST_CASE(no_patch_on_size_change)
+{
+    std::string prev_enc, cur_enc;
+    binary::encoder prev_encoder(prev_enc);
+    binary::encoder cur_encoder(cur_enc);
+    prev_encoder(sequence_t(100, integer_t(1)));
+    cur_encoder(sequence_t(101, integer_t(1)));
+
+    std::string patch;
+    BOOST_REQUIRE(!binary::encode_patch(patch, prev_enc, cur_enc));
+    BOOST_REQUIRE(patch.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
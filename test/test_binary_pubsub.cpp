@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <decof/all.h>
+#include <decof/binary/codec.h>
+#include <decof/binary/delta.h>
+#include <decof/binary/pubsub_context.h>
+#include <decof/cli/pubsub_context.h>
+#include <decof/client_context/generic_tcp_server.h>
+#include <boost/asio/read.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(binary_pubsub)
+
+using namespace decof;
+namespace asio = boost::asio;
+
+struct fixture
+{
+    struct frame
+    {
+        binary::frame_type type;
+        std::string        body;
+    };
+
+    fixture()
+      : io_service(),
+        strand(io_service),
+        od("test"),
+        server(od, strand, asio::ip::tcp::endpoint(asio::ip::tcp::v4(), 0)),
+        int_param("int_param", &od, 1),
+        seq_param("seq_param", &od, std::vector<double>(10000, 0.5))
+    {
+        server.preload();
+    }
+
+    void connect(asio::ip::tcp::socket& sock, unsigned short port)
+    {
+        sock.connect(asio::ip::tcp::endpoint(asio::ip::address::from_string("127.0.0.1"), port));
+        io_service.poll();
+    }
+
+    void send(asio::ip::tcp::socket& sock, binary::frame_type type, const std::string& body)
+    {
+        std::string request;
+        binary::write_frame_header(request, type, body.size());
+        request += body;
+
+        asio::write(sock, asio::buffer(request));
+        io_service.poll();
+    }
+
+    frame receive(asio::ip::tcp::socket& sock)
+    {
+        char header[binary::frame_header_size];
+        asio::read(sock, asio::buffer(header));
+
+        frame retval;
+        retval.type = static_cast<binary::frame_type>(header[4]);
+        retval.body.resize(read_le<std::uint32_t>(header) - 1);
+        asio::read(sock, asio::buffer(&retval.body[0], retval.body.size()));
+
+        return retval;
+    }
+
+    /// Decodes an update frame into parameter id and value.
+    std::pair<std::uint32_t, value_t> decode_update(const frame& f)
+    {
+        BOOST_REQUIRE(f.type == binary::frame_type::update);
+        binary::decoder decoder(f.body.data() + 12, f.body.data() + f.body.size());
+        return {read_le<std::uint32_t>(f.body.data()), decoder.value()};
+    }
+
+    asio::io_service         io_service;
+    asio::io_service::strand strand;
+
+    object_dictionary                          od;
+    generic_tcp_server<binary::pubsub_context> server;
+
+    managed_readonly_parameter<int>                 int_param;
+    managed_readonly_parameter<std::vector<double>> seq_param;
+};
+
+BOOST_FIXTURE_TEST_CASE(subscribe, fixture)
+{
+    asio::ip::tcp::socket sock(io_service);
+    connect(sock, server.port());
+
+    send(sock, binary::frame_type::subscribe, "int_param");
+
+    auto announce = receive(sock);
+    BOOST_REQUIRE(announce.type == binary::frame_type::announce);
+    const auto id = read_le<std::uint32_t>(announce.body.data());
+    BOOST_REQUIRE_EQUAL(announce.body.substr(4), "int_param");
+
+    auto update = decode_update(receive(sock));
+    BOOST_REQUIRE_EQUAL(update.first, id);
+    BOOST_REQUIRE(update.second == value_t(scalar_t(integer_t(1))));
+
+    int_param.value(2);
+    io_service.poll();
+    update = decode_update(receive(sock));
+    BOOST_REQUIRE(update.second == value_t(scalar_t(integer_t(2))));
+
+    // No more updates after unsubscribing
+    send(sock, binary::frame_type::unsubscribe, "int_param");
+    int_param.value(3);
+    io_service.poll();
+    BOOST_REQUIRE_EQUAL(sock.available(), 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(unknown_parameter, fixture)
+{
+    asio::ip::tcp::socket sock(io_service);
+    connect(sock, server.port());
+
+    send(sock, binary::frame_type::subscribe, "unknown");
+
+    auto error = receive(sock);
+    BOOST_REQUIRE(error.type == binary::frame_type::error);
+    BOOST_REQUIRE_EQUAL(read_le<std::uint32_t>(error.body.data()), INVALID_PARAMETER);
+}
+
+BOOST_FIXTURE_TEST_CASE(delta_updates, fixture)
+{
+    asio::ip::tcp::socket sock(io_service);
+    connect(sock, server.port());
+
+    // Enable delta updates with a keyframe every third update
+    std::string options(1, static_cast<char>(binary::delta_updates));
+    write_le(options, std::uint32_t(3));
+    send(sock, binary::frame_type::options, options);
+
+    send(sock, binary::frame_type::subscribe, "seq_param");
+    receive(sock);
+
+    // The initial value is sent in full
+    auto value = decode_update(receive(sock)).second;
+
+    std::vector<double> current(10000, 0.5);
+    for (int i = 0; i < 4; ++i) {
+        current[i * 100] = i;
+        seq_param.value(current);
+        io_service.poll();
+
+        auto f = receive(sock);
+        if (i == 2) {
+            // Keyframe
+            value = decode_update(f).second;
+        } else {
+            BOOST_REQUIRE(f.type == binary::frame_type::patch);
+            BOOST_REQUIRE_LT(f.body.size(), 64u);
+            binary::apply_patch(value, f.body.data() + 12, f.body.data() + f.body.size());
+        }
+
+        BOOST_REQUIRE(value == conversion_helper<std::vector<double>>::to_generic(current));
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(benchmark, fixture)
+{
+    const std::size_t count = 100;
+
+    generic_tcp_server<cli::pubsub_context> text_server(od, strand, asio::ip::tcp::endpoint(asio::ip::tcp::v4(), 0));
+    text_server.preload();
+
+    // Text protocol
+    asio::ip::tcp::socket text_sock(io_service);
+    connect(text_sock, text_server.port());
+    asio::write(text_sock, asio::buffer(std::string("subscribe seq_param\n")));
+    io_service.poll();
+
+    asio::streambuf buf;
+    asio::read_until(text_sock, buf, '\n');
+    buf.consume(buf.size());
+
+    std::size_t text_bytes = 0;
+    auto        start      = std::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i < count; ++i) {
+        seq_param.value(std::vector<double>(10000, i / 3.0));
+        io_service.poll();
+
+        text_bytes += asio::read_until(text_sock, buf, '\n');
+        buf.consume(buf.size());
+    }
+    auto text_duration = std::chrono::high_resolution_clock::now() - start;
+    text_sock.close();
+
+    // Binary protocol
+    asio::ip::tcp::socket sock(io_service);
+    connect(sock, server.port());
+    send(sock, binary::frame_type::subscribe, "seq_param");
+    receive(sock);
+    receive(sock);
+
+    std::size_t binary_bytes = 0;
+    start                    = std::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i < count; ++i) {
+        seq_param.value(std::vector<double>(10000, i / 3.0));
+        io_service.poll();
+
+        binary_bytes += binary::frame_header_size + receive(sock).body.size();
+    }
+    auto binary_duration = std::chrono::high_resolution_clock::now() - start;
+
+    BOOST_REQUIRE_LT(binary_bytes, text_bytes);
+
+    std::cout << "Publishing " << count << " updates of a 10000 element real sequence took "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(text_duration).count() << " ms and "
+              << text_bytes << " bytes with cli::pubsub_context and "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(binary_duration).count() << " ms and "
+              << binary_bytes << " bytes with binary::pubsub_context" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
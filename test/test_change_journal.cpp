@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <decof/all.h>
+#include <boost/test/unit_test.hpp>
+#include <string>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(change_journal)
+
+using namespace decof;
+
+BOOST_AUTO_TEST_CASE(disabled_by_default)
+{
+    decof::change_journal journal;
+
+    BOOST_REQUIRE_EQUAL(journal.enabled(), false);
+    BOOST_REQUIRE_EQUAL(journal.record("root:param"), 0u);
+    BOOST_REQUIRE_EQUAL(journal.covers(journal.last_sequence()), false);
+}
+
+BOOST_AUTO_TEST_CASE(monotonic_sequence_numbers)
+{
+    decof::change_journal journal(10);
+
+    const auto start = journal.last_sequence();
+    const auto seq1  = journal.record("root:a");
+    const auto seq2  = journal.record("root:b");
+
+    BOOST_REQUIRE_EQUAL(seq1, start + 1);
+    BOOST_REQUIRE_EQUAL(seq2, start + 2);
+    BOOST_REQUIRE_EQUAL(journal.last_sequence(), seq2);
+}
+
+BOOST_AUTO_TEST_CASE(changed_since)
+{
+    decof::change_journal journal(10);
+
+    const auto seq1 = journal.record("root:a");
+    journal.record("root:b");
+
+    BOOST_REQUIRE(journal.covers(seq1));
+    BOOST_REQUIRE(!journal.changed_since("root:a", seq1));
+    BOOST_REQUIRE(journal.changed_since("root:b", seq1));
+
+    std::vector<std::string> uris;
+    journal.for_each_since(seq1 - 1, [&uris](const decof::change_journal::entry& e) { uris.push_back(e.uri); });
+    BOOST_REQUIRE_EQUAL(uris.size(), 2u);
+    BOOST_REQUIRE_EQUAL(uris[0], "root:a");
+    BOOST_REQUIRE_EQUAL(uris[1], "root:b");
+}
+
+BOOST_AUTO_TEST_CASE(overflow)
+{
+    decof::change_journal journal(2);
+
+    const auto start = journal.last_sequence();
+    journal.record("root:a");
+    journal.record("root:b");
+    BOOST_REQUIRE(journal.covers(start));
+
+    journal.record("root:c");
+    BOOST_REQUIRE(!journal.covers(start));
+    BOOST_REQUIRE(journal.covers(start + 1));
+}
+
+BOOST_AUTO_TEST_CASE(foreign_sequence_number)
+{
+    decof::change_journal journal(10);
+
+    // Sequence numbers from a previous server instance are lower than the
+    // first sequence number of this instance ...
+    BOOST_REQUIRE(!journal.covers(1));
+
+    // ... and numbers from the future are never covered either.
+    BOOST_REQUIRE(!journal.covers(journal.last_sequence() + 1));
+}
+
+BOOST_AUTO_TEST_CASE(record_on_emit)
+{
+    object_dictionary                 od("root");
+    managed_readonly_parameter<int>   ro_param("ro_param", &od, 0);
+    managed_readwrite_parameter<bool> rw_param("rw_param", &od, false);
+
+    od.journal().capacity(10);
+    const auto start = od.journal().last_sequence();
+
+    ro_param.value(1);
+    ro_param.value(1);
+
+    BOOST_REQUIRE_EQUAL(od.journal().last_sequence(), start + 1);
+    BOOST_REQUIRE(od.journal().changed_since("root:ro_param", start));
+    BOOST_REQUIRE(!od.journal().changed_since("root:rw_param", start));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
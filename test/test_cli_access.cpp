@@ -21,11 +21,15 @@
 #include <decof/client_context/generic_tcp_server.h>
 
 #include <boost/algorithm/string.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
 #include <boost/asio/read_until.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <chrono>
+#include <iostream>
 #include <sstream>
 #include <string>
+#include <unistd.h>
 
 BOOST_AUTO_TEST_SUITE(cli_access)
 
@@ -128,6 +132,30 @@ BOOST_FIXTURE_TEST_CASE(omit_root_node_name, fixture)
     BOOST_REQUIRE_EQUAL(str, "#t");
 }
 
+BOOST_FIXTURE_TEST_CASE(heat_report, fixture)
+{
+    managed_readonly_parameter<bool> cold("cold", &od, true);
+    managed_readonly_parameter<bool> hot("hot", &od, true);
+    od.heat().enabled(true);
+
+    for (const char* request : {"get hot\n", "get cold\n", "get hot\n"}) {
+        client_sock.write_some(asio::buffer(std::string(request)));
+        io_service.poll();
+        asio::read_until(client_sock, buf, std::string("> "));
+        buf.consume(buf.size());
+    }
+
+    client_sock.write_some(asio::buffer(std::string("heat 1 count\n")));
+    io_service.poll();
+    asio::read_until(client_sock, buf, std::string("> "));
+    std::getline(is, str);
+    BOOST_REQUIRE_EQUAL(str.substr(0, str.find(' ', 14)), "test:hot READ 2");
+    BOOST_REQUIRE_NE(str.find("WRITE 0 0us OBSERVE 0 EMIT 0"), std::string::npos);
+
+    std::getline(is, str);
+    BOOST_REQUIRE_EQUAL(str, "> ");
+}
+
 BOOST_FIXTURE_TEST_CASE(boolean_readonly, fixture)
 {
     managed_readonly_parameter<bool> boolean_ro("boolean_ro", &od, true);
@@ -405,4 +433,92 @@ BOOST_FIXTURE_TEST_CASE(tuple_readwrite, fixture)
     BOOST_REQUIRE(current == expected);
 }
 
+/// Returns an endpoint in the Linux abstract namespace unique to this process.
+asio::local::stream_protocol::endpoint abstract_endpoint()
+{
+    return asio::local::stream_protocol::endpoint(std::string(1, '\0') + "decof2-test-" + std::to_string(::getpid()));
+}
+
+/// Sends a request and waits for the response line.
+template <typename Socket>
+std::string round_trip(fixture& f, Socket& sock, const std::string& request)
+{
+    sock.write_some(asio::buffer(request));
+    while (sock.available() == 0)
+        f.io_service.poll();
+
+    asio::streambuf buf;
+    asio::read_until(sock, buf, std::string("\n"));
+
+    std::string line;
+    std::getline(std::istream(&buf) >> std::ws, line);
+    return line;
+}
+
+BOOST_FIXTURE_TEST_CASE(local_socket, fixture)
+{
+    managed_readonly_parameter<bool> dummy("dummy", &od, true);
+
+    std::string peer;
+    cli::cli_context_base::install_connection_event_callback(
+        [&peer](bool, bool connect, const std::string& peer_address) {
+            if (connect)
+                peer = peer_address;
+        });
+
+    generic_local_server<cli::clisrv_context> local_server(od, strand, abstract_endpoint());
+    local_server.preload();
+
+    asio::local::stream_protocol::socket sock(io_service);
+    sock.connect(abstract_endpoint());
+    io_service.poll();
+    asio::read_until(sock, buf, std::string("\n> "));
+    buf.consume(buf.size());
+
+    BOOST_REQUIRE_EQUAL(round_trip(*this, sock, "get dummy\n"), "#t");
+
+    // Unix domain peers are identified by their credentials
+    const std::string expected_peer = "unix:pid=" + std::to_string(::getpid()) + ",uid=" + std::to_string(::getuid()) +
+        ",gid=" + std::to_string(::getgid());
+    BOOST_REQUIRE_EQUAL(peer, expected_peer);
+
+    cli::cli_context_base::install_connection_event_callback(nullptr);
+    sock.close();
+    io_service.poll();
+}
+
+BOOST_FIXTURE_TEST_CASE(benchmark_local_socket, fixture)
+{
+    const std::size_t                count = 2000;
+    managed_readonly_parameter<bool> dummy("dummy", &od, true);
+
+    generic_local_server<cli::clisrv_context> local_server(od, strand, abstract_endpoint());
+    local_server.preload();
+
+    asio::local::stream_protocol::socket local_sock(io_service);
+    local_sock.connect(abstract_endpoint());
+    io_service.poll();
+    asio::read_until(local_sock, buf, std::string("\n> "));
+    buf.consume(buf.size());
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i < count; ++i)
+        round_trip(*this, client_sock, "get dummy\n");
+    auto tcp_duration = std::chrono::high_resolution_clock::now() - start;
+
+    start = std::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i < count; ++i)
+        round_trip(*this, local_sock, "get dummy\n");
+    auto local_duration = std::chrono::high_resolution_clock::now() - start;
+
+    std::cout << count << " request/response round trips took "
+              << std::chrono::duration_cast<std::chrono::microseconds>(tcp_duration).count() / count
+              << " us each over loopback TCP and "
+              << std::chrono::duration_cast<std::chrono::microseconds>(local_duration).count() / count
+              << " us each over a Unix domain socket" << std::endl;
+
+    local_sock.close();
+    io_service.poll();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <decof/all.h>
+#include <decof/cli/pubsub_context.h>
+#include <decof/client_context/generic_tcp_server.h>
+#include <boost/asio/read_until.hpp>
+#include <boost/test/unit_test.hpp>
+#include <string>
+
+BOOST_AUTO_TEST_SUITE(cli_pubsub)
+
+using namespace decof;
+namespace asio = boost::asio;
+
+struct fixture
+{
+    fixture()
+      : io_service(),
+        strand(io_service),
+        od("test"),
+        server(od, strand, asio::ip::tcp::endpoint(asio::ip::tcp::v4(), 0)),
+        param1("param1", &od, 1),
+        param2("param2", &od, 2)
+    {
+        od.journal().capacity(100);
+        server.preload();
+    }
+
+    void connect(asio::ip::tcp::socket& sock)
+    {
+        sock.connect(asio::ip::tcp::endpoint(asio::ip::address::from_string("127.0.0.1"), server.port()));
+        io_service.poll();
+    }
+
+    void send(asio::ip::tcp::socket& sock, const std::string& request)
+    {
+        sock.write_some(asio::buffer(request));
+        io_service.poll();
+    }
+
+    /// Reads the next update and returns it without timestamp, e.g. "param1 1".
+    std::string receive(asio::ip::tcp::socket& sock)
+    {
+        std::string line;
+        asio::read_until(sock, buf, '\n');
+        std::getline(is, line);
+
+        auto pos = line.find('\'');
+        BOOST_REQUIRE(pos != std::string::npos);
+        return line.substr(pos + 1, line.size() - pos - 2);
+    }
+
+    asio::io_service         io_service;
+    asio::io_service::strand strand;
+
+    object_dictionary                       od;
+    generic_tcp_server<cli::pubsub_context> server;
+
+    managed_readonly_parameter<int> param1;
+    managed_readonly_parameter<int> param2;
+
+    asio::streambuf buf;
+    std::istream    is{&buf};
+};
+
+BOOST_FIXTURE_TEST_CASE(subscribe_sequence_number, fixture)
+{
+    asio::ip::tcp::socket sock(io_service);
+    connect(sock);
+
+    send(sock, "subscribe seq\n");
+    BOOST_REQUIRE_EQUAL(receive(sock), "seq " + std::to_string(od.journal().last_sequence()));
+
+    send(sock, "subscribe param1\n");
+    BOOST_REQUIRE_EQUAL(receive(sock), "param1 1");
+
+    param1.value(10);
+    io_service.poll();
+    BOOST_REQUIRE_EQUAL(receive(sock), "param1 10");
+    BOOST_REQUIRE_EQUAL(receive(sock), "seq " + std::to_string(od.journal().last_sequence()));
+}
+
+BOOST_FIXTURE_TEST_CASE(resume_delivers_deltas_only, fixture)
+{
+    const auto sequence = od.journal().last_sequence();
+    param2.value(20);
+
+    asio::ip::tcp::socket sock(io_service);
+    connect(sock);
+
+    send(sock, "resume " + std::to_string(sequence) + "\n");
+    BOOST_REQUIRE_EQUAL(receive(sock), "resume #t");
+
+    // param1 did not change since 'sequence', so nothing is sent for it
+    send(sock, "subscribe param1\nsubscribe param2\n");
+    BOOST_REQUIRE_EQUAL(receive(sock), "param2 20");
+
+    // Later changes are delivered as usual
+    param1.value(10);
+    io_service.poll();
+    BOOST_REQUIRE_EQUAL(receive(sock), "param1 10");
+}
+
+BOOST_FIXTURE_TEST_CASE(resume_after_overflow, fixture)
+{
+    od.journal().capacity(1);
+
+    const auto sequence = od.journal().last_sequence();
+    param1.value(10);
+    param2.value(20);
+
+    asio::ip::tcp::socket sock(io_service);
+    connect(sock);
+
+    send(sock, "resume " + std::to_string(sequence) + "\n");
+    BOOST_REQUIRE_EQUAL(receive(sock), "resume #f");
+
+    // Full resync
+    send(sock, "subscribe param1\n");
+    BOOST_REQUIRE_EQUAL(receive(sock), "param1 10");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
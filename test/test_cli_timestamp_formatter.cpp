@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <cli/timestamp_formatter.h>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+BOOST_AUTO_TEST_SUITE(cli_timestamp_formatter)
+
+using namespace decof;
+using namespace std::chrono;
+using cli::timestamp_formatter;
+
+namespace {
+
+timestamp_formatter::time_point make_time_point(std::int64_t us)
+{
+    return timestamp_formatter::time_point(duration_cast<system_clock::duration>(microseconds(us)));
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(millisecond_precision)
+{
+    timestamp_formatter formatter;
+
+    BOOST_REQUIRE_EQUAL(formatter.format(make_time_point(0)), "1970-01-01T00:00:00.000Z");
+    BOOST_REQUIRE_EQUAL(formatter.format(make_time_point(1792353104091808)), "2026-10-18T19:51:44.091Z");
+    BOOST_REQUIRE_EQUAL(formatter.format(make_time_point(1792353104999999)), "2026-10-18T19:51:44.999Z");
+    BOOST_REQUIRE_EQUAL(formatter.format(make_time_point(1792353105000000)), "2026-10-18T19:51:45.000Z");
+}
+
+BOOST_AUTO_TEST_CASE(microsecond_precision)
+{
+    timestamp_formatter formatter(timestamp_formatter::precision::microseconds);
+
+    BOOST_REQUIRE_EQUAL(formatter.format(make_time_point(951782400000001)), "2000-02-29T00:00:00.000001Z");
+    BOOST_REQUIRE_EQUAL(formatter.format(make_time_point(951868799999999)), "2000-02-29T23:59:59.999999Z");
+}
+
+BOOST_AUTO_TEST_CASE(before_epoch)
+{
+    timestamp_formatter formatter;
+
+    BOOST_REQUIRE_EQUAL(formatter.format(make_time_point(-1000)), "1969-12-31T23:59:59.999Z");
+}
+
+BOOST_AUTO_TEST_CASE(matches_gmtime)
+{
+    timestamp_formatter formatter;
+
+    // Step through a day in irregular steps so that both cached and
+    // uncached paths are exercised
+    for (std::int64_t us = 1792281600000000; us < 1792368000000000; us += 7777777) {
+        const auto         tp = make_time_point(us);
+        const std::time_t  t  = system_clock::to_time_t(tp);
+        std::ostringstream nominal;
+        nominal << std::put_time(std::gmtime(&t), "%FT%T.") << std::setw(3) << std::setfill('0')
+                << (us / 1000) % 1000 << 'Z';
+
+        BOOST_REQUIRE_EQUAL(formatter.format(tp), nominal.str());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(benchmark)
+{
+    const std::size_t count = 1000000;
+    const auto        now   = system_clock::now();
+
+    // Reference: formatting through std::put_time on a stream
+    std::ostringstream out;
+    auto               start = high_resolution_clock::now();
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::time_t t = system_clock::to_time_t(now + microseconds(i));
+        out << std::put_time(std::gmtime(&t), "%FT%T.000Z");
+        out.seekp(0);
+    }
+    auto put_time_duration = high_resolution_clock::now() - start;
+
+    timestamp_formatter formatter;
+    std::size_t         length = 0;
+    start                      = high_resolution_clock::now();
+    for (std::size_t i = 0; i < count; ++i)
+        length += formatter.format(now + microseconds(i)).size();
+    auto formatter_duration = high_resolution_clock::now() - start;
+
+    BOOST_REQUIRE_EQUAL(length, count * 24);
+
+    std::cout << "Formatting " << count << " timestamps took "
+              << duration_cast<milliseconds>(put_time_duration).count() << " ms with std::put_time and "
+              << duration_cast<milliseconds>(formatter_duration).count() << " ms with cli::timestamp_formatter"
+              << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -17,6 +17,7 @@
 #define BOOST_TEST_DYN_LINK
 
 #include <decof/cli/update_container.h>
+#include <decof/cli/update_queue.h>
 #include <decof/types.h>
 #include <boost/test/unit_test.hpp>
 #include <iostream>
@@ -214,4 +215,31 @@ BOOST_FIXTURE_TEST_CASE(push_and_pop_interchangeably, fixture)
     BOOST_REQUIRE_EQUAL(updates_.empty(), true);
 }
 
+BOOST_AUTO_TEST_CASE(queue_reports_sequence_when_drained)
+{
+    cli::update_queue                queue;
+    cli::update_queue::update        update;
+    cli::update_queue::sequence_type sequence = 0;
+
+    BOOST_REQUIRE_EQUAL(queue.push("a", integer_t(1), 10), true);
+    BOOST_REQUIRE_EQUAL(queue.push("b", integer_t(2), 11), false);
+
+    BOOST_REQUIRE_EQUAL(queue.pop_front(update, sequence), true);
+    BOOST_REQUIRE_EQUAL(std::get<0>(update), "a");
+    BOOST_REQUIRE_EQUAL(sequence, 0u);
+
+    // The sequence number of an update still queued must not be reported
+    BOOST_REQUIRE_EQUAL(queue.push("c", integer_t(3), 12), false);
+    BOOST_REQUIRE_EQUAL(queue.pop_front(update, sequence), true);
+    BOOST_REQUIRE_EQUAL(queue.pop_front(update, sequence), true);
+    BOOST_REQUIRE_EQUAL(std::get<0>(update), "c");
+    BOOST_REQUIRE_EQUAL(sequence, 0u);
+
+    BOOST_REQUIRE_EQUAL(queue.pop_front(update, sequence), false);
+    BOOST_REQUIRE_EQUAL(sequence, 12u);
+
+    // The consumer is idle again after draining the queue
+    BOOST_REQUIRE_EQUAL(queue.push("a", integer_t(4), 13), true);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+
+#include <decof/all.h>
+#include <decof/cli/clisrv_context.h>
+#include <decof/client_context/generic_tcp_server.h>
+#include <decof/coroutine/clisrv_context.h>
+
+#include <boost/asio/read_until.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <string_view>
+
+namespace {
+
+std::atomic<std::size_t> allocations{0};
+
+} // Anonymous namespace
+
+// Counts the allocations of the whole test program, which is good enough to
+// compare per-request allocations of single-threaded round trips.
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    if (void* p = std::malloc(size == 0 ? 1 : size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+BOOST_AUTO_TEST_SUITE(coroutine_context)
+
+using namespace decof;
+namespace asio = boost::asio;
+
+template <typename Context>
+struct fixture
+{
+    fixture()
+      : io_service(),
+        strand(io_service),
+        client_sock(io_service),
+        od("test"),
+        server(od, strand, asio::ip::tcp::endpoint(asio::ip::tcp::v4(), 0))
+    {
+        server.preload();
+
+        // Connect with server and wait for prompt
+        client_sock.connect(asio::ip::tcp::endpoint(asio::ip::address::from_string("127.0.0.1"), server.port()));
+        BOOST_REQUIRE_EQUAL(receive_response(), "DeCoF command line\n");
+    }
+
+    /// Runs the I/O service until a complete response followed by the prompt
+    /// was received and returns it without the prompt.
+    std::string_view receive_response()
+    {
+        std::size_t size = 0;
+        while (size < 2 || std::string_view(buffer + size - 2, 2) != "> ") {
+            io_service.poll();
+            if (client_sock.available() > 0)
+                size += client_sock.read_some(asio::buffer(buffer + size, sizeof(buffer) - size));
+        }
+
+        return std::string_view(buffer, size - 2);
+    }
+
+    std::string_view round_trip(std::string_view request)
+    {
+        client_sock.write_some(asio::buffer(request.data(), request.size()));
+        return receive_response();
+    }
+
+    asio::io_service             io_service;
+    asio::io_service::strand     strand;
+    boost::asio::ip::tcp::socket client_sock;
+    char                         buffer[1024];
+
+    object_dictionary           od;
+    generic_tcp_server<Context> server;
+};
+
+using coroutine_fixture = fixture<coroutine::clisrv_context>;
+
+BOOST_FIXTURE_TEST_CASE(get_and_set, coroutine_fixture)
+{
+    managed_readwrite_parameter<integer_t> param("param", &od, 42);
+
+    BOOST_REQUIRE_EQUAL(round_trip("get param\n"), "42\n");
+    BOOST_REQUIRE_EQUAL(round_trip("set param 4711\n"), "0\n");
+    BOOST_REQUIRE_EQUAL(param.value(), 4711);
+    BOOST_REQUIRE_EQUAL(round_trip("param-ref 'param\n"), "4711\n");
+}
+
+BOOST_FIXTURE_TEST_CASE(report_errors, coroutine_fixture)
+{
+    BOOST_REQUIRE(round_trip("get unknown\n").substr(0, 6) == "ERROR ");
+    BOOST_REQUIRE(round_trip("foo bar\n").substr(0, 6) == "ERROR ");
+
+    // The connection is still usable
+    BOOST_REQUIRE_EQUAL(round_trip("get ul\n"), std::to_string(Normal) + "\n");
+}
+
+BOOST_FIXTURE_TEST_CASE(disconnect, coroutine_fixture)
+{
+    int connects = 0, disconnects = 0;
+    cli::cli_context_base::install_connection_event_callback([&](bool, bool connect, const std::string&) {
+        ++(connect ? connects : disconnects);
+    });
+
+    asio::ip::tcp::socket sock(io_service);
+    sock.connect(asio::ip::tcp::endpoint(asio::ip::address::from_string("127.0.0.1"), server.port()));
+    io_service.poll();
+    BOOST_REQUIRE_EQUAL(connects, 1);
+
+    sock.close();
+    while (disconnects == 0)
+        io_service.poll();
+
+    cli::cli_context_base::install_connection_event_callback(nullptr);
+}
+
+template <typename Context>
+void benchmark(const char* name)
+{
+    const std::size_t                 count = 10000;
+    fixture<Context>                  f;
+    managed_readonly_parameter<bool>  dummy("dummy", &f.od, true);
+
+    // Warm up buffers and handler memory
+    f.round_trip("get dummy\n");
+
+    const auto allocations_before = allocations.load();
+    const auto start              = std::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i < count; ++i)
+        f.round_trip("get dummy\n");
+    const auto duration = std::chrono::high_resolution_clock::now() - start;
+
+    std::cout << count << " request/response round trips with " << name << " took "
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() / count << " ns each and "
+              << static_cast<double>(allocations.load() - allocations_before) / count << " allocations per request"
+              << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(benchmark_callbacks_vs_coroutines)
+{
+    benchmark<cli::clisrv_context>("callbacks");
+    benchmark<coroutine::clisrv_context>("coroutines");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+
+#include <decof/all.h>
+#include <decof/cli/pubsub_context.h>
+#include <decof/client_context/flush_scheduler.h>
+#include <decof/client_context/generic_tcp_server.h>
+#include <boost/asio/read_until.hpp>
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <iostream>
+#include <list>
+#include <string>
+#include <thread>
+
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+
+std::atomic<std::size_t> sendmsg_calls{0};
+
+} // Anonymous namespace
+
+// Boost.Asio writes to sockets using sendmsg(), which is interposed in order
+// to count write system calls.
+extern "C" ssize_t sendmsg(int fd, const struct msghdr* msg, int flags)
+{
+    ++sendmsg_calls;
+    return ::syscall(SYS_sendmsg, fd, msg, flags);
+}
+
+BOOST_AUTO_TEST_SUITE(flush_scheduler)
+
+using namespace decof;
+namespace asio = boost::asio;
+
+struct fixture
+{
+    fixture()
+      : io_service(),
+        strand(io_service),
+        scheduler(asio::use_service<decof::flush_scheduler>(io_service)),
+        od("test"),
+        server(od, strand, asio::ip::tcp::endpoint(asio::ip::tcp::v4(), 0)),
+        param("param", &od, 1)
+    {
+        server.preload();
+    }
+
+    void connect(asio::ip::tcp::socket& sock)
+    {
+        sock.connect(asio::ip::tcp::endpoint(asio::ip::address::from_string("127.0.0.1"), server.port()));
+        io_service.poll();
+        sock.write_some(asio::buffer(std::string("subscribe param\n")));
+        io_service.poll();
+    }
+
+    /// Reads the next update and returns it without timestamp, e.g. "param 1".
+    std::string receive(asio::ip::tcp::socket& sock)
+    {
+        std::string line;
+        asio::read_until(sock, buf, '\n');
+        std::getline(is, line);
+
+        auto pos = line.find('\'');
+        BOOST_REQUIRE(pos != std::string::npos);
+        return line.substr(pos + 1, line.size() - pos - 2);
+    }
+
+    /// Runs the I/O service until @a sock is readable.
+    void wait_readable(asio::ip::tcp::socket& sock)
+    {
+        while (sock.available() == 0) {
+            io_service.reset();
+            io_service.poll();
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+
+    asio::io_service         io_service;
+    asio::io_service::strand strand;
+    decof::flush_scheduler&  scheduler;
+
+    object_dictionary                       od;
+    generic_tcp_server<cli::pubsub_context> server;
+
+    managed_readonly_parameter<int> param;
+
+    asio::streambuf buf;
+    std::istream    is{&buf};
+};
+
+BOOST_FIXTURE_TEST_CASE(flush_immediately_by_default, fixture)
+{
+    BOOST_REQUIRE(scheduler.interval() == std::chrono::microseconds(0));
+
+    asio::ip::tcp::socket sock(io_service);
+    connect(sock);
+    BOOST_REQUIRE_EQUAL(receive(sock), "param 1");
+
+    param.value(2);
+    io_service.poll();
+    BOOST_REQUIRE_EQUAL(receive(sock), "param 2");
+    BOOST_REQUIRE_EQUAL(scheduler.batches(), 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(coalesce_changes_within_interval, fixture)
+{
+    scheduler.interval(std::chrono::milliseconds(200));
+
+    asio::ip::tcp::socket sock1(io_service), sock2(io_service);
+    connect(sock1);
+    connect(sock2);
+
+    param.value(2);
+    param.value(3);
+    io_service.poll();
+    BOOST_REQUIRE_EQUAL(sock1.available(), 0u);
+
+    // Initial value and changes of both connections are flushed by one batch
+    wait_readable(sock1);
+    wait_readable(sock2);
+    BOOST_REQUIRE_EQUAL(receive(sock1), "param 3");
+    BOOST_REQUIRE_EQUAL(receive(sock2), "param 3");
+    BOOST_REQUIRE_EQUAL(scheduler.batches(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(benchmark_500_connections)
+{
+    const std::size_t               connections = 500;
+    const std::size_t               changes     = 100;
+    const std::chrono::microseconds change_period(1000);
+
+    for (auto interval : {std::chrono::microseconds(0), std::chrono::microseconds(10000)}) {
+        fixture f;
+        f.scheduler.interval(interval);
+
+        std::list<asio::ip::tcp::socket> socks;
+        for (std::size_t i = 0; i < connections; ++i)
+            f.connect(socks.emplace_back(f.io_service));
+
+        for (auto& sock : socks) {
+            f.wait_readable(sock);
+            f.receive(sock);
+        }
+
+        // Change the parameter periodically while the clients are idle
+        const auto sendmsg_before = sendmsg_calls.load();
+        const auto cpu_before     = std::clock();
+        const auto start          = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < changes; ++i) {
+            while (std::chrono::steady_clock::now() < start + i * change_period) {
+                f.io_service.reset();
+                f.io_service.poll();
+            }
+
+            f.param.value(static_cast<int>(i + 2));
+            f.io_service.poll();
+        }
+
+        std::this_thread::sleep_for(interval);
+        f.io_service.reset();
+        f.io_service.poll();
+
+        const auto writes = sendmsg_calls.load() - sendmsg_before;
+        const auto cpu    = static_cast<double>(std::clock() - cpu_before) / CLOCKS_PER_SEC;
+
+        // Each client finally receives the last value
+        for (auto& sock : socks) {
+            std::string last;
+            while (sock.available() > 0 || f.buf.size() > 0)
+                last = f.receive(sock);
+            BOOST_REQUIRE_EQUAL(last, "param " + std::to_string(changes + 1));
+        }
+
+        std::cout << connections << " connections, " << changes << " changes every " << change_period.count()
+                  << " us, flush interval " << interval.count() << " us: "
+                  << static_cast<double>(writes) / changes << " write system calls and "
+                  << cpu * 1e6 / changes << " us CPU time per change" << std::endl;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+
+#include <decof/all.h>
+#include <decof/cli/clisrv_context.h>
+#include <decof/client_context/generic_tcp_server.h>
+#include <boost/asio/read.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+BOOST_AUTO_TEST_SUITE(generic_server)
+
+using namespace decof;
+namespace asio = boost::asio;
+
+struct fixture
+{
+    fixture()
+      : io_service(),
+        strand(io_service),
+        od("test"),
+        server(od, strand, asio::ip::tcp::endpoint(asio::ip::tcp::v4(), 0))
+    {
+    }
+
+    void connect(asio::ip::tcp::socket& sock)
+    {
+        sock.connect(asio::ip::tcp::endpoint(asio::ip::address::from_string("127.0.0.1"), server.port()));
+        poll();
+    }
+
+    void poll()
+    {
+        io_service.reset();
+        io_service.poll();
+    }
+
+    /// Runs the I/O service for the given time.
+    void run_for(std::chrono::milliseconds duration)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < deadline) {
+            poll();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    /// Returns whether the peer closed the connection.
+    bool closed_by_peer(asio::ip::tcp::socket& sock)
+    {
+        char                      c;
+        boost::system::error_code ec;
+        while (sock.available() > 0)
+            sock.read_some(asio::buffer(&c, 1), ec);
+
+        sock.non_blocking(true);
+        sock.read_some(asio::buffer(&c, 1), ec);
+        sock.non_blocking(false);
+        return ec == asio::error::eof || ec == asio::error::connection_reset;
+    }
+
+    asio::io_service         io_service;
+    asio::io_service::strand strand;
+
+    object_dictionary                       od;
+    generic_tcp_server<cli::clisrv_context> server;
+};
+
+BOOST_FIXTURE_TEST_CASE(shed_connections_above_limit, fixture)
+{
+    server.max_connections(1);
+    server.preload();
+
+    asio::ip::tcp::socket sock1(io_service), sock2(io_service);
+    connect(sock1);
+    connect(sock2);
+
+    BOOST_REQUIRE_EQUAL(server.connections(), 1u);
+    BOOST_REQUIRE_EQUAL(server.rejected_connections(), 1u);
+    BOOST_REQUIRE(!closed_by_peer(sock1));
+    BOOST_REQUIRE(closed_by_peer(sock2));
+
+    // A connection is accepted again once there is room for it
+    sock1.close();
+    run_for(std::chrono::milliseconds(10));
+    BOOST_REQUIRE_EQUAL(server.connections(), 0u);
+
+    asio::ip::tcp::socket sock3(io_service);
+    connect(sock3);
+    BOOST_REQUIRE_EQUAL(server.connections(), 1u);
+    BOOST_REQUIRE(!closed_by_peer(sock3));
+}
+
+BOOST_FIXTURE_TEST_CASE(reap_idle_connections, fixture)
+{
+    managed_readonly_parameter<bool> dummy("dummy", &od, true);
+
+    server.idle_timeout(std::chrono::milliseconds(100));
+    server.preload();
+
+    asio::ip::tcp::socket idle(io_service), busy(io_service);
+    connect(idle);
+    connect(busy);
+
+    // Keep one connection busy for more than the idle timeout
+    asio::streambuf buf;
+    for (int i = 0; i < 10; ++i) {
+        busy.write_some(asio::buffer(std::string("get dummy\n")));
+        run_for(std::chrono::milliseconds(30));
+        asio::read_until(busy, buf, std::string("> "));
+        buf.consume(buf.size());
+    }
+
+    BOOST_REQUIRE(closed_by_peer(idle));
+    BOOST_REQUIRE(!closed_by_peer(busy));
+    BOOST_REQUIRE_EQUAL(server.reaped_connections(), 1u);
+    BOOST_REQUIRE_EQUAL(server.connections(), 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(retry_after_accept_error, fixture)
+{
+    server.preload();
+
+    asio::ip::tcp::socket sock(io_service);
+    sock.open(asio::ip::tcp::v4());
+
+    // Make accepting fail by running out of file descriptors
+    rlimit limit;
+    ::getrlimit(RLIMIT_NOFILE, &limit);
+    const auto saved_limit = limit;
+    const int  lowest_free = ::dup(0);
+    ::close(lowest_free);
+    limit.rlim_cur = lowest_free;
+    ::setrlimit(RLIMIT_NOFILE, &limit);
+
+    connect(sock);
+    BOOST_REQUIRE_NO_THROW(run_for(std::chrono::milliseconds(50)));
+    BOOST_REQUIRE_EQUAL(server.connections(), 0u);
+
+    ::setrlimit(RLIMIT_NOFILE, &saved_limit);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (server.connections() == 0 && std::chrono::steady_clock::now() < deadline)
+        run_for(std::chrono::milliseconds(10));
+    BOOST_REQUIRE_EQUAL(server.connections(), 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(expose_connection_counts, fixture)
+{
+    node server_node("server", &od);
+    server.max_connections(1);
+    server.expose_connection_counts(&server_node);
+    server.preload();
+
+    asio::ip::tcp::socket sock1(io_service), sock2(io_service);
+    connect(sock1);
+    connect(sock2);
+
+    auto value_of = [this](const std::string& uri) {
+        auto param = dynamic_cast<client_read_interface*>(od.find_descendant_object(uri));
+        BOOST_REQUIRE(param != nullptr);
+        return std::get<integer_t>(std::get<scalar_t>(param->generic_value()));
+    };
+
+    BOOST_REQUIRE_EQUAL(value_of("server:connections"), 1);
+    BOOST_REQUIRE_EQUAL(value_of("server:rejected-connections"), 1);
+    BOOST_REQUIRE_EQUAL(value_of("server:reaped-connections"), 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(replace_stale_local_socket, fixture)
+{
+    const std::string                      path = "/tmp/decof2-test-" + std::to_string(::getpid()) + ".sock";
+    asio::local::stream_protocol::endpoint endpoint(path);
+    struct stat                            status;
+
+    // A socket file is left over by a listener that is gone
+    {
+        asio::local::stream_protocol::acceptor stale(io_service, endpoint);
+    }
+    BOOST_REQUIRE_EQUAL(::stat(path.c_str(), &status), 0);
+
+    {
+        generic_local_server<cli::clisrv_context> local_server(od, strand, endpoint);
+        local_server.preload();
+
+        asio::local::stream_protocol::socket sock(io_service);
+        sock.connect(endpoint);
+        poll();
+        BOOST_REQUIRE_EQUAL(local_server.connections(), 1u);
+
+        // A socket still accepting connections is not replaced
+        BOOST_REQUIRE_THROW(generic_local_server<cli::clisrv_context>(od, strand, endpoint),
+                            boost::system::system_error);
+    }
+
+    // The socket file is removed along with the server
+    BOOST_REQUIRE_NE(::stat(path.c_str(), &status), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <decof/all.h>
+#include <decof/client_context/client_context.h>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(heat_map)
+
+using namespace decof;
+
+namespace {
+
+struct context_t : public client_context
+{
+    using client_context::client_context;
+
+    value_t get(const std::string& uri)
+    {
+        return get_parameter(object_dictionary_.find_object(uri));
+    }
+
+    void set(const std::string& uri, const value_t& value)
+    {
+        set_parameter(object_dictionary_.find_object(uri), value);
+    }
+
+    void observe(const std::string& uri)
+    {
+        client_context::observe(object_dictionary_.find_object(uri), [](const std::string&, const value_t&) {});
+    }
+
+    std::vector<decof::heat_map::record> report(std::size_t count, decof::heat_map::sort_key key)
+    {
+        return heat_report(count, key);
+    }
+};
+
+struct slow_parameter : public external_readonly_parameter<integer_t>
+{
+    using external_readonly_parameter<integer_t>::external_readonly_parameter;
+
+    integer_t external_value() const override
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        return 0;
+    }
+};
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(disabled_by_default)
+{
+    object_dictionary                      od;
+    managed_readwrite_parameter<integer_t> param("param", &od);
+    auto                                   context = std::make_shared<context_t>(od);
+
+    BOOST_REQUIRE_EQUAL(od.heat().enabled(), false);
+
+    context->get("root:param");
+    context->set("root:param", integer_t(1));
+
+    BOOST_REQUIRE(od.heat().sorted(decof::heat_map::sort_key::count).empty());
+}
+
+BOOST_AUTO_TEST_CASE(count_accesses)
+{
+    object_dictionary                      od;
+    managed_readwrite_parameter<integer_t> param("param", &od);
+    auto                                   context = std::make_shared<context_t>(od);
+
+    od.heat().enabled(true);
+
+    context->get("root:param");
+    context->get("root:param");
+    context->observe("root:param");
+    context->set("root:param", integer_t(1));
+    context->set("root:param", integer_t(2));
+
+    const auto records = od.heat().sorted(decof::heat_map::sort_key::count);
+    BOOST_REQUIRE_EQUAL(records.size(), 1u);
+    BOOST_REQUIRE_EQUAL(records[0].obj, &param);
+    BOOST_REQUIRE_EQUAL(records[0].uri, "root:param");
+
+    // Each write emits a change
+    const auto& values = records[0].values;
+    BOOST_REQUIRE_EQUAL(values.reads, 2u);
+    BOOST_REQUIRE_EQUAL(values.writes, 2u);
+    BOOST_REQUIRE_EQUAL(values.observes, 1u);
+    BOOST_REQUIRE_EQUAL(values.emits, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(sort_by_count_or_time)
+{
+    object_dictionary                      od;
+    managed_readwrite_parameter<integer_t> frequent("frequent", &od);
+    slow_parameter                         slow("slow", &od);
+    auto                                   context = std::make_shared<context_t>(od);
+
+    od.heat().enabled(true);
+
+    for (int i = 0; i < 5; ++i)
+        context->get("root:frequent");
+    context->get("root:slow");
+
+    auto by_count = context->report(10, decof::heat_map::sort_key::count);
+    BOOST_REQUIRE_EQUAL(by_count.size(), 2u);
+    BOOST_REQUIRE_EQUAL(by_count[0].uri, "root:frequent");
+
+    auto by_time = context->report(1, decof::heat_map::sort_key::time);
+    BOOST_REQUIRE_EQUAL(by_time.size(), 1u);
+    BOOST_REQUIRE_EQUAL(by_time[0].uri, "root:slow");
+    BOOST_REQUIRE(by_time[0].values.read_time >= std::chrono::milliseconds(2));
+}
+
+BOOST_AUTO_TEST_CASE(report_skips_hidden_and_destroyed_objects)
+{
+    object_dictionary                      od;
+    managed_readwrite_parameter<integer_t> visible("visible", &od);
+    managed_readonly_parameter<integer_t>  hidden("hidden", &od, Internal, 0);
+    auto                                   context = std::make_shared<context_t>(od);
+
+    od.heat().enabled(true);
+    context->get("root:visible");
+    od.heat().count(&hidden, decof::heat_map::access::read);
+
+    {
+        managed_readwrite_parameter<integer_t> temporary("temporary", &od);
+        context->get("root:temporary");
+    }
+
+    const auto records = context->report(10, decof::heat_map::sort_key::count);
+    BOOST_REQUIRE_EQUAL(records.size(), 1u);
+    BOOST_REQUIRE_EQUAL(records[0].uri, "root:visible");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
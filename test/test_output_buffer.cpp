@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <decof/client_context/output_buffer.h>
+#include <decof/scgi/response.h>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/buffers_iterator.hpp>
+#include <boost/test/unit_test.hpp>
+#include <memory>
+#include <ostream>
+#include <string>
+
+BOOST_AUTO_TEST_SUITE(output_buffer)
+
+using namespace decof;
+
+struct fixture
+{
+    /// Concatenates the unconsumed buffer contents.
+    std::string contents()
+    {
+        const auto bufs = buf.data();
+        return std::string(boost::asio::buffers_begin(bufs), boost::asio::buffers_end(bufs));
+    }
+
+    decof::output_buffer buf;
+};
+
+BOOST_FIXTURE_TEST_CASE(initial_empty, fixture)
+{
+    BOOST_REQUIRE(buf.empty());
+    BOOST_REQUIRE_EQUAL(buf.data().size(), 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(copied_appends_are_coalesced, fixture)
+{
+    buf.append(std::string_view("Hello"));
+    buf.append(std::string_view(", world"));
+
+    BOOST_REQUIRE_EQUAL(buf.data().size(), 1u);
+    BOOST_REQUIRE_EQUAL(contents(), "Hello, world");
+    BOOST_REQUIRE_EQUAL(buf.bytes_copied(), 12u);
+    BOOST_REQUIRE_EQUAL(buf.bytes_referenced(), 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(zero_copy_appends, fixture)
+{
+    auto shared = std::make_shared<const std::string>("shared ");
+
+    buf.append_static("static ");
+    buf.append(shared);
+    buf.append(std::string(100, 'x'));
+
+    BOOST_REQUIRE_EQUAL(buf.data().size(), 3u);
+    BOOST_REQUIRE_EQUAL(contents(), "static shared " + std::string(100, 'x'));
+    BOOST_REQUIRE_EQUAL(buf.bytes_copied(), 0u);
+    BOOST_REQUIRE_EQUAL(buf.bytes_referenced(), 114u);
+    BOOST_REQUIRE_EQUAL(boost::asio::buffer_cast<const char*>(buf.data()[1]), shared->data());
+}
+
+BOOST_FIXTURE_TEST_CASE(consume, fixture)
+{
+    buf.append_static("abc");
+    buf.append(std::string("defgh"));
+
+    buf.consume(2);
+    BOOST_REQUIRE_EQUAL(buf.size(), 6u);
+    BOOST_REQUIRE_EQUAL(contents(), "cdefgh");
+
+    buf.consume(1);
+    BOOST_REQUIRE_EQUAL(buf.data().size(), 1u);
+    BOOST_REQUIRE_EQUAL(contents(), "defgh");
+
+    buf.consume(100);
+    BOOST_REQUIRE(buf.empty());
+}
+
+BOOST_FIXTURE_TEST_CASE(append_during_write, fixture)
+{
+    buf.append(std::string_view("first"));
+    const auto bufs = buf.data();
+
+    // Appending after data() must not modify the buffers being written
+    buf.append(std::string_view(std::string(4096, 'y')));
+    BOOST_REQUIRE_EQUAL(std::string(boost::asio::buffers_begin(bufs), boost::asio::buffers_end(bufs)), "first");
+
+    buf.consume(5);
+    BOOST_REQUIRE_EQUAL(contents(), std::string(4096, 'y'));
+}
+
+BOOST_FIXTURE_TEST_CASE(stream_output, fixture)
+{
+    {
+        output_streambuf sbuf(buf);
+        std::ostream     out(&sbuf);
+        out << "value " << 42 << ' ' << std::string(1000, 'z');
+    }
+
+    BOOST_REQUIRE_EQUAL(contents(), "value 42 " + std::string(1000, 'z'));
+    BOOST_REQUIRE_EQUAL(buf.bytes_copied(), 1009u);
+}
+
+BOOST_FIXTURE_TEST_CASE(scgi_response_body_not_copied, fixture)
+{
+    scgi::response resp = scgi::response::stock_response(scgi::response::status_code::ok);
+    resp.body           = std::string(10000, 'b');
+    resp.serialize(buf);
+
+    const std::string header = "HTTP/1.1 200 OK\r\n"
+                               "Content-Type: text/plain\r\n"
+                               "Content-Length: 10000\r\n\r\n";
+    BOOST_REQUIRE_EQUAL(contents(), header + std::string(10000, 'b'));
+    BOOST_REQUIRE_EQUAL(buf.bytes_copied(), header.size());
+    BOOST_REQUIRE_EQUAL(buf.bytes_referenced(), 10000u);
+    BOOST_REQUIRE(resp.body.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -17,6 +17,7 @@
 #define BOOST_TEST_DYN_LINK
 
 #include <decof/all.h>
+#include <decof/binary/codec.h>
 #include <decof/client_context/generic_tcp_server.h>
 #include <decof/scgi/scgi_context.h>
 #include <scgi/bencode_string_parser.h>
@@ -25,8 +26,16 @@
 #include <boost/algorithm/string/trim.hpp>
 #include <boost/asio.hpp>
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iostream>
 #include <iterator>
+#include <memory>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -117,6 +126,64 @@ std::ostream& operator<<(std::ostream& os, const scgi_request& r)
     return os;
 }
 
+/**
+ * Sends a GET request on a new connection and returns the response headers.
+ * The status line and body are returned with the keys "status" and "body".
+ */
+std::unordered_map<std::string, std::string>
+conditional_get(fixture&                                  f,
+                const std::string&                        uri,
+                const std::string&                        if_none_match = std::string(),
+                const std::map<std::string, std::string>& attributes    = {})
+{
+    scgi_request request({{"CONTENT_LENGTH", "0"},
+                          {"SCGI", "1"},
+                          {"REMOTE_PORT", "12345"},
+                          {"REMOTE_ADDR", "127.0.0.1"},
+                          {"REQUEST_URI", uri},
+                          {"REQUEST_METHOD", "GET"}});
+    if (!if_none_match.empty())
+        request.attributes["HTTP_IF_NONE_MATCH"] = if_none_match;
+    request.attributes.insert(attributes.begin(), attributes.end());
+
+    // SCGI permits a single request per connection
+    f.client_sock.close();
+    f.client_sock.connect(asio::ip::tcp::endpoint(asio::ip::address::from_string("127.0.0.1"), f.server.port()));
+
+    std::stringstream request_ss;
+    request_ss << request;
+    f.client_sock.write_some(asio::buffer(request_ss.str()));
+    while (f.client_sock.available() == 0)
+        f.io_service.poll();
+
+    // Read status line and headers
+    std::unordered_map<std::string, std::string> headers;
+    asio::read_until(f.client_sock, f.buf, std::string("\r\n\r\n"));
+    std::getline(f.is, f.str, '\n');
+    headers["status"] = boost::trim_copy(f.str);
+    while (std::getline(f.is, f.str, '\n')) {
+        std::string trimmed_str = boost::trim_copy(f.str);
+        if (trimmed_str.empty())
+            break;
+
+        auto colon_idx = trimmed_str.find(':');
+        if (colon_idx != std::string::npos)
+            headers[trimmed_str.substr(0, colon_idx)] = boost::trim_copy(trimmed_str.substr(colon_idx + 1));
+    }
+
+    // Read body
+    if (headers.count("Content-Length")) {
+        std::size_t length = std::stoul(headers["Content-Length"]);
+        if (f.buf.size() < length)
+            asio::read(f.client_sock, f.buf, asio::transfer_exactly(length - f.buf.size()));
+
+        headers["body"].resize(length);
+        f.is.read(&headers["body"][0], length);
+    }
+
+    return headers;
+}
+
 struct test_event_type : public event
 {
     using event::event;
@@ -615,6 +682,69 @@ BOOST_FIXTURE_TEST_CASE(put_real_seq, fixture)
     BOOST_REQUIRE_EQUAL_COLLECTIONS(data, data + sizeof(data) / sizeof(data[0]), actual.cbegin(), actual.cend());
 }
 
+BOOST_FIXTURE_TEST_CASE(put_large_real_seq, fixture)
+{
+    managed_readwrite_parameter<std::vector<double>> real_seq_rw("real_seq_rw", &od);
+
+    std::vector<double> data(500000);
+    for (std::size_t i = 0; i < data.size(); ++i)
+        data[i] = i / 7.0;
+
+    ss << scgi_request(
+        {{"CONTENT_LENGTH", std::to_string(data.size() * sizeof(double))},
+         {"SCGI", "1"},
+         {"REMOTE_PORT", "12345"},
+         {"REMOTE_ADDR", "127.0.0.1"},
+         {"REQUEST_URI", "/test/real_seq_rw"},
+         {"REQUEST_METHOD", "PUT"},
+         {"CONTENT_TYPE", "vnd/com.toptica.decof.real_seq"}},
+        {reinterpret_cast<char*>(data.data()), data.size() * sizeof(double)});
+
+    // Client and server must make progress concurrently
+    const std::string request = ss.str();
+    bool              written = false;
+    asio::async_write(client_sock, asio::buffer(request), [&written](const boost::system::error_code&, std::size_t) {
+        written = true;
+    });
+    while (!written || client_sock.available() == 0)
+        io_service.poll();
+
+    // Read response header
+    asio::read_until(client_sock, buf, std::string("\r\n\r\n"));
+    std::getline(is, str, '\r');
+    BOOST_REQUIRE_EQUAL(str, "HTTP/1.1 200 OK");
+
+    std::vector<double> actual = real_seq_rw.value();
+    BOOST_REQUIRE(actual == data);
+}
+
+BOOST_FIXTURE_TEST_CASE(put_too_large, fixture)
+{
+    managed_readwrite_parameter<std::string> string_rw("string_rw", &od);
+
+    scgi::scgi_context::max_body_size(1024);
+
+    // The body is rejected before it is sent
+    ss << scgi_request({{"CONTENT_LENGTH", "2048"},
+                        {"SCGI", "1"},
+                        {"REMOTE_PORT", "12345"},
+                        {"REMOTE_ADDR", "127.0.0.1"},
+                        {"REQUEST_URI", "/test/string_rw"},
+                        {"REQUEST_METHOD", "PUT"},
+                        {"CONTENT_TYPE", "vnd/com.toptica.decof.string"}});
+
+    client_sock.write_some(asio::buffer(ss.str()));
+    while (client_sock.available() == 0)
+        io_service.poll();
+
+    scgi::scgi_context::max_body_size(16 * 1024 * 1024);
+
+    // Read response header
+    asio::read_until(client_sock, buf, std::string("\r\n\r\n"));
+    std::getline(is, str, '\r');
+    BOOST_REQUIRE_EQUAL(str, "HTTP/1.1 413 Payload Too Large");
+}
+
 BOOST_FIXTURE_TEST_CASE(get_string_seq, fixture)
 {
     managed_readonly_parameter<std::vector<std::string>> string_seq_ro("string_seq_ro", &od, {"Line1\r\n", "Line2"});
@@ -723,4 +853,491 @@ BOOST_FIXTURE_TEST_CASE(browse, fixture)
     BOOST_REQUIRE_GT(std::stoi(headers["Content-Length"]), 0);
 }
 
+BOOST_FIXTURE_TEST_CASE(browse_not_modified, fixture)
+{
+    auto first = conditional_get(*this, "/browse");
+    BOOST_REQUIRE_EQUAL(first["status"], "HTTP/1.1 200 OK");
+    BOOST_REQUIRE(!first["ETag"].empty());
+
+    auto second = conditional_get(*this, "/browse", "\"other\", " + first["ETag"]);
+    BOOST_REQUIRE_EQUAL(second["status"], "HTTP/1.1 304 Not Modified");
+    BOOST_REQUIRE_EQUAL(second["ETag"], first["ETag"]);
+    BOOST_REQUIRE_EQUAL(second.count("Content-Length"), 0u);
+
+    // Changing the tree structure invalidates the description
+    managed_readonly_parameter<std::string> string_ro("string_ro", &od, "Hello");
+
+    auto third = conditional_get(*this, "/browse", first["ETag"]);
+    BOOST_REQUIRE_EQUAL(third["status"], "HTTP/1.1 200 OK");
+    BOOST_REQUIRE_NE(third["ETag"], first["ETag"]);
+}
+
+BOOST_FIXTURE_TEST_CASE(get_not_modified, fixture)
+{
+    managed_readonly_parameter<integer_t> integer_ro("integer_ro", &od, 1);
+
+    auto first = conditional_get(*this, "/test/integer_ro");
+    BOOST_REQUIRE_EQUAL(first["status"], "HTTP/1.1 200 OK");
+    BOOST_REQUIRE_EQUAL(first["body"], "1");
+    BOOST_REQUIRE(!first["ETag"].empty());
+
+    auto second = conditional_get(*this, "/test/integer_ro", first["ETag"]);
+    BOOST_REQUIRE_EQUAL(second["status"], "HTTP/1.1 304 Not Modified");
+    BOOST_REQUIRE_EQUAL(second["ETag"], first["ETag"]);
+    BOOST_REQUIRE_EQUAL(second.count("body"), 0u);
+
+    // Changing the value changes its version
+    integer_ro.value(2);
+
+    auto third = conditional_get(*this, "/test/integer_ro", first["ETag"]);
+    BOOST_REQUIRE_EQUAL(third["status"], "HTTP/1.1 200 OK");
+    BOOST_REQUIRE_EQUAL(third["body"], "2");
+    BOOST_REQUIRE_NE(third["ETag"], first["ETag"]);
+}
+
+BOOST_FIXTURE_TEST_CASE(get_batch, fixture)
+{
+    managed_readonly_parameter<integer_t>   integer_ro("integer_ro", &od, 42);
+    managed_readonly_parameter<std::string> string_ro("string_ro", &od, "Hello");
+    managed_readonly_parameter<integer_t>   internal_ro("internal_ro", &od, Internal, 1);
+
+    auto result = conditional_get(
+        *this, "/batch?uri=%2Ftest%2Finteger_ro&uri=/test/missing&uri=/test/internal_ro&other=1&uri=/test/string_ro");
+    BOOST_REQUIRE_EQUAL(result["status"], "HTTP/1.1 200 OK");
+
+    const std::string prefix = "multipart/mixed; boundary=";
+    BOOST_REQUIRE_EQUAL(result["Content-Type"].substr(0, prefix.size()), prefix);
+    const std::string boundary = result["Content-Type"].substr(prefix.size());
+
+    // Split parts and collect status and body per URI
+    std::vector<std::string> parts;
+    const std::string&       body = result["body"];
+    for (auto pos = body.find("--" + boundary); pos != std::string::npos;) {
+        auto next = body.find("\r\n--" + boundary, pos + 2);
+        if (next == std::string::npos)
+            break;
+        parts.push_back(body.substr(pos + 2 + boundary.size() + 2, next - pos - 2 - boundary.size() - 2));
+        pos = next + 2;
+    }
+    BOOST_REQUIRE_EQUAL(body.substr(body.size() - boundary.size() - 6), "--" + boundary + "--\r\n");
+    BOOST_REQUIRE_EQUAL(parts.size(), 4u);
+
+    auto expect_part = [&parts](
+                           std::size_t i, const std::string& uri, const std::string& status, const std::string& value) {
+        const auto& part = parts[i];
+        BOOST_CHECK_NE(part.find("Content-Location: " + uri + "\r\n"), std::string::npos);
+        BOOST_CHECK_NE(part.find("Status: " + status + "\r\n"), std::string::npos);
+        BOOST_CHECK_EQUAL(part.substr(part.find("\r\n\r\n") + 4), value);
+    };
+
+    expect_part(0, "/test/integer_ro", "200 OK", "42");
+    expect_part(1, "/test/missing", "404 Not Found", "");
+    expect_part(2, "/test/internal_ro", "401 Unauthorized", "");
+    expect_part(3, "/test/string_ro", "200 OK", "Hello");
+    BOOST_CHECK_NE(parts[0].find("ETag: "), std::string::npos);
+}
+
+BOOST_FIXTURE_TEST_CASE(get_heat, fixture)
+{
+    managed_readonly_parameter<integer_t> integer_ro("integer_ro", &od, 42);
+    managed_readonly_parameter<integer_t> other_ro("other_ro", &od, 1);
+    od.heat().enabled(true);
+
+    conditional_get(*this, "/test/integer_ro");
+    conditional_get(*this, "/test/other_ro");
+    conditional_get(*this, "/test/integer_ro");
+
+    auto result = conditional_get(*this, "/heat?top=1&sort=count");
+    BOOST_REQUIRE_EQUAL(result["status"], "HTTP/1.1 200 OK");
+    BOOST_REQUIRE_EQUAL(result["Content-Type"], "application/json");
+
+    const auto& body = result["body"];
+    BOOST_REQUIRE_EQUAL(body.substr(0, 49), "[{\"uri\":\"/test/integer_ro\",\"reads\":2,\"read-time\":");
+    BOOST_REQUIRE_NE(body.find("\"writes\":0,\"write-time\":0,\"observes\":0,\"emits\":0}]"), std::string::npos);
+
+    result = conditional_get(*this, "/heat?sort=hottest");
+    BOOST_REQUIRE_EQUAL(result["status"], "HTTP/1.1 400 Bad Request");
+}
+
+BOOST_FIXTURE_TEST_CASE(get_latency, fixture)
+{
+    managed_readonly_parameter<integer_t> integer_ro("integer_ro", &od, 42);
+
+    const auto before = statistics::collect();
+    auto       result = conditional_get(*this, "/test/integer_ro");
+    const auto after  = statistics::collect();
+    BOOST_REQUIRE_EQUAL(result["status"], "HTTP/1.1 200 OK");
+
+    std::uint64_t latencies = 0;
+    for (std::size_t i = 0; i < statistics::latency_buckets; ++i)
+        latencies += after.latencies[i] - before.latencies[i];
+    BOOST_REQUIRE_EQUAL(latencies, 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(post_batch, fixture)
+{
+    managed_readonly_parameter<integer_t> integer_ro("integer_ro", &od, 42);
+
+    const std::string uris = "/test/integer_ro\r\n/test/missing\n";
+    ss << scgi_request({{"CONTENT_LENGTH", std::to_string(uris.size())},
+                        {"SCGI", "1"},
+                        {"REMOTE_PORT", "12345"},
+                        {"REMOTE_ADDR", "127.0.0.1"},
+                        {"REQUEST_URI", "/batch"},
+                        {"REQUEST_METHOD", "POST"},
+                        {"CONTENT_TYPE", "text/plain"}},
+                       uris);
+
+    client_sock.write_some(asio::buffer(ss.str()));
+    while (client_sock.available() == 0)
+        io_service.poll();
+
+    asio::read_until(client_sock, buf, std::string("\r\n\r\n"));
+    std::getline(is, str, '\r');
+    BOOST_REQUIRE_EQUAL(str, "HTTP/1.1 200 OK");
+
+    // Read the complete response up to the closing boundary
+    asio::read_until(client_sock, buf, std::string("--\r\n"));
+    std::string response_str(asio::buffers_begin(buf.data()), asio::buffers_end(buf.data()));
+    BOOST_CHECK_NE(response_str.find("Content-Location: /test/integer_ro\r\nStatus: 200 OK"), std::string::npos);
+    BOOST_CHECK_NE(response_str.find("Content-Location: /test/missing\r\nStatus: 404 Not Found"), std::string::npos);
+}
+
+BOOST_FIXTURE_TEST_CASE(event_stream, fixture)
+{
+    managed_readonly_parameter<integer_t> integer_ro("integer_ro", &od, 1);
+    node                                  sub("sub", &od);
+    managed_readonly_parameter<integer_t> sub_integer_ro("integer_ro", &sub, 2);
+
+    ss << scgi_request({{"CONTENT_LENGTH", "0"},
+                        {"SCGI", "1"},
+                        {"REMOTE_PORT", "12345"},
+                        {"REMOTE_ADDR", "127.0.0.1"},
+                        {"REQUEST_URI", "/events?uri=/test/integer_ro&uri=/test/sub"},
+                        {"REQUEST_METHOD", "GET"}});
+
+    client_sock.write_some(asio::buffer(ss.str()));
+
+    auto read_event = [this]() {
+        std::string buffered;
+        while ((buffered = std::string(asio::buffers_begin(buf.data()), asio::buffers_end(buf.data())))
+                   .find("\n\n") == std::string::npos) {
+            io_service.poll();
+            if (client_sock.available() > 0)
+                asio::read(client_sock, buf, asio::transfer_exactly(client_sock.available()));
+        }
+
+        auto event = buffered.substr(0, buffered.find("\n\n") + 2);
+        buf.consume(event.size());
+        return event;
+    };
+
+    // Read response header
+    while (client_sock.available() == 0)
+        io_service.poll();
+    asio::read_until(client_sock, buf, std::string("\r\n\r\n"));
+    std::getline(is, str, '\n');
+    BOOST_REQUIRE_EQUAL(boost::trim_copy(str), "HTTP/1.1 200 OK");
+
+    std::unordered_map<std::string, std::string> headers;
+    while (std::getline(is, str, '\n')) {
+        std::string trimmed_str = boost::trim_copy(str);
+        if (trimmed_str.empty())
+            break;
+        auto colon_idx = trimmed_str.find(':');
+        if (colon_idx != std::string::npos)
+            headers[trimmed_str.substr(0, colon_idx)] = boost::trim_copy(trimmed_str.substr(colon_idx + 1));
+    }
+    BOOST_REQUIRE_EQUAL(headers["Content-Type"], "text/event-stream");
+    BOOST_REQUIRE_EQUAL(headers.count("Content-Length"), 0u);
+
+    // Initial values
+    BOOST_REQUIRE_EQUAL(read_event(), "data: {\"uri\":\"/test/integer_ro\",\"value\":1}\n\n");
+    BOOST_REQUIRE_EQUAL(read_event(), "data: {\"uri\":\"/test/sub/integer_ro\",\"value\":2}\n\n");
+
+    // Value change
+    sub_integer_ro.value(3);
+    BOOST_REQUIRE_EQUAL(read_event(), "data: {\"uri\":\"/test/sub/integer_ro\",\"value\":3}\n\n");
+
+    // Closing the connection ends the observation
+    client_sock.close();
+    io_service.poll();
+    io_service.poll();
+    integer_ro.value(4);
+    io_service.poll();
+}
+
+BOOST_FIXTURE_TEST_CASE(put_tuple, fixture)
+{
+    using full_tuple = std::tuple<bool, integer_t, double, std::string>;
+    managed_readwrite_parameter<full_tuple> tuple_rw("tuple_rw", &od);
+
+    // Trailing whitespace is part of the value
+    std::string     data;
+    binary::encoder encoder(data);
+    encoder(value_t{tuple_t{{true, integer_t{-1}, -1.23, string_t{"Hello World "}}}});
+
+    ss << scgi_request({{"CONTENT_LENGTH", std::to_string(data.size())},
+                        {"SCGI", "1"},
+                        {"REMOTE_PORT", "12345"},
+                        {"REMOTE_ADDR", "127.0.0.1"},
+                        {"REQUEST_URI", "/test/tuple_rw"},
+                        {"REQUEST_METHOD", "PUT"},
+                        {"CONTENT_TYPE", "vnd/com.toptica.decof.tuple"}},
+                       data);
+
+    client_sock.write_some(asio::buffer(ss.str()));
+    while (client_sock.available() == 0)
+        io_service.poll();
+
+    asio::read_until(client_sock, buf, std::string("\r\n\r\n"));
+    std::getline(is, str, '\r');
+    BOOST_REQUIRE_EQUAL(str, "HTTP/1.1 200 OK");
+    BOOST_REQUIRE(tuple_rw.value() == full_tuple(true, -1, -1.23, "Hello World "));
+}
+
+BOOST_FIXTURE_TEST_CASE(put_tuple_malformed, fixture)
+{
+    using full_tuple = std::tuple<bool, integer_t, double, std::string>;
+    managed_readwrite_parameter<full_tuple> tuple_rw("tuple_rw", &od);
+
+    // Truncated encoding
+    std::string     data;
+    binary::encoder encoder(data);
+    encoder(value_t{tuple_t{{true, integer_t{-1}, -1.23, string_t{"Hello World"}}}});
+    data.resize(data.size() - 1);
+
+    ss << scgi_request({{"CONTENT_LENGTH", std::to_string(data.size())},
+                        {"SCGI", "1"},
+                        {"REMOTE_PORT", "12345"},
+                        {"REMOTE_ADDR", "127.0.0.1"},
+                        {"REQUEST_URI", "/test/tuple_rw"},
+                        {"REQUEST_METHOD", "PUT"},
+                        {"CONTENT_TYPE", "vnd/com.toptica.decof.tuple"}},
+                       data);
+
+    client_sock.write_some(asio::buffer(ss.str()));
+    while (client_sock.available() == 0)
+        io_service.poll();
+
+    asio::read_until(client_sock, buf, std::string("\r\n\r\n"));
+    std::getline(is, str, '\r');
+    BOOST_REQUIRE_EQUAL(str, "HTTP/1.1 400 Bad Request");
+}
+
+BOOST_FIXTURE_TEST_CASE(get_tuple, fixture)
+{
+    using full_tuple = std::tuple<bool, integer_t, double, std::string>;
+    managed_readonly_parameter<full_tuple> tuple_ro("tuple_ro", &od, full_tuple(true, -1, -1.23, "Hello World"));
+
+    scgi_request request({{"CONTENT_LENGTH", "0"},
+                          {"SCGI", "1"},
+                          {"REMOTE_PORT", "12345"},
+                          {"REMOTE_ADDR", "127.0.0.1"},
+                          {"REQUEST_URI", "/test/tuple_ro"},
+                          {"REQUEST_METHOD", "GET"},
+                          {"HTTP_ACCEPT", "vnd/com.toptica.decof.tuple, text/plain;q=0.5"}});
+    ss << request;
+
+    client_sock.write_some(asio::buffer(ss.str()));
+    while (client_sock.available() == 0)
+        io_service.poll();
+
+    asio::read_until(client_sock, buf, std::string("\r\n\r\n"));
+    std::getline(is, str, '\n');
+    BOOST_REQUIRE_EQUAL(boost::trim_copy(str), "HTTP/1.1 200 OK");
+
+    std::unordered_map<std::string, std::string> headers;
+    while (std::getline(is, str, '\n')) {
+        std::string trimmed_str = boost::trim_copy(str);
+        if (trimmed_str.empty())
+            break;
+        auto colon_idx = trimmed_str.find(':');
+        if (colon_idx != std::string::npos)
+            headers[trimmed_str.substr(0, colon_idx)] = boost::trim_copy(trimmed_str.substr(colon_idx + 1));
+    }
+    BOOST_REQUIRE_EQUAL(headers["Content-Type"], "vnd/com.toptica.decof.tuple");
+
+    std::size_t length = std::stoul(headers["Content-Length"]);
+    if (buf.size() < length)
+        asio::read(client_sock, buf, asio::transfer_exactly(length - buf.size()));
+    std::string body(length, '\0');
+    is.read(&body[0], length);
+
+    binary::decoder decoder(body.data(), body.data() + body.size());
+    BOOST_REQUIRE(decoder.value() == value_t(tuple_t{{true, integer_t{-1}, -1.23, string_t{"Hello World"}}}));
+    BOOST_REQUIRE(decoder.position() == body.data() + body.size());
+}
+
+BOOST_FIXTURE_TEST_CASE(get_binary_range, fixture)
+{
+    managed_readonly_parameter<std::string, encoding_hint::binary> bin_ro("bin_ro", &od, "Hello World");
+
+    auto resp = conditional_get(*this, "/test/bin_ro", "", {{"HTTP_RANGE", "bytes=6-"}});
+    BOOST_REQUIRE_EQUAL(resp["status"], "HTTP/1.1 206 Partial Content");
+    BOOST_REQUIRE_EQUAL(resp["Content-Range"], "bytes 6-10/11");
+    BOOST_REQUIRE_EQUAL(resp["body"], "World");
+
+    // A range for an outdated value yields the complete value
+    resp = conditional_get(*this, "/test/bin_ro", "", {{"HTTP_RANGE", "bytes=6-"}, {"HTTP_IF_RANGE", "\"0\""}});
+    BOOST_REQUIRE_EQUAL(resp["status"], "HTTP/1.1 200 OK");
+    BOOST_REQUIRE_EQUAL(resp["Accept-Ranges"], "bytes");
+    BOOST_REQUIRE_EQUAL(resp["body"], "Hello World");
+
+    resp = conditional_get(*this, "/test/bin_ro", "", {{"HTTP_RANGE", "bytes=11-"}});
+    BOOST_REQUIRE_EQUAL(resp["status"], "HTTP/1.1 416 Requested Range Not Satisfiable");
+    BOOST_REQUIRE_EQUAL(resp["Content-Range"], "bytes */11");
+}
+
+BOOST_FIXTURE_TEST_CASE(get_real_seq_range, fixture)
+{
+    managed_readonly_parameter<std::vector<double>> real_seq_ro("real_seq_ro", &od, {1.0, 2.0, 3.0, 4.0});
+
+    auto resp = conditional_get(*this, "/test/real_seq_ro", "", {{"HTTP_RANGE", "bytes=8-23"}});
+    BOOST_REQUIRE_EQUAL(resp["status"], "HTTP/1.1 206 Partial Content");
+    BOOST_REQUIRE_EQUAL(resp["Content-Range"], "bytes 8-23/32");
+    BOOST_REQUIRE_EQUAL(resp["body"].size(), 16u);
+
+    double elems[2];
+    std::memcpy(elems, resp["body"].data(), sizeof(elems));
+    BOOST_REQUIRE_EQUAL(elems[0], 2.0);
+    BOOST_REQUIRE_EQUAL(elems[1], 3.0);
+}
+
+struct external_string_type : public external_readonly_parameter<std::string>
+{
+    using external_readonly_parameter<std::string>::external_readonly_parameter;
+
+    std::string external_value() const override
+    {
+        return "Hello";
+    }
+};
+
+BOOST_FIXTURE_TEST_CASE(get_string_if_range, fixture)
+{
+    managed_readonly_parameter<std::string> string_ro("string_ro", &od, "Hello");
+    external_string_type                    string_ext("string_ext", &od);
+
+    auto full = conditional_get(*this, "/test/string_ro");
+    auto resp =
+        conditional_get(*this, "/test/string_ro", "", {{"HTTP_RANGE", "bytes=1-2"}, {"HTTP_IF_RANGE", full["ETag"]}});
+    BOOST_REQUIRE_EQUAL(resp["status"], "HTTP/1.1 206 Partial Content");
+    BOOST_REQUIRE_EQUAL(resp["body"], "el");
+
+    // Mismatching validators return the full value
+    resp = conditional_get(*this, "/test/string_ro", "", {{"HTTP_RANGE", "bytes=1-2"}, {"HTTP_IF_RANGE", "\"x\""}});
+    BOOST_REQUIRE_EQUAL(resp["status"], "HTTP/1.1 200 OK");
+    BOOST_REQUIRE_EQUAL(resp["body"], "Hello");
+
+    // Values without version have no entity tag for If-Range to match
+    resp = conditional_get(*this, "/test/string_ext", "", {{"HTTP_RANGE", "bytes=1-2"}, {"HTTP_IF_RANGE", ""}});
+    BOOST_REQUIRE_EQUAL(resp["status"], "HTTP/1.1 200 OK");
+    BOOST_REQUIRE_EQUAL(resp.count("ETag"), 0u);
+    BOOST_REQUIRE_EQUAL(resp["body"], "Hello");
+}
+
+BOOST_FIXTURE_TEST_CASE(get_json, fixture)
+{
+    managed_readonly_parameter<std::vector<double>> real_seq_ro("real_seq_ro", &od, {1.5, -2.0});
+
+    auto resp = conditional_get(*this, "/test/real_seq_ro", "", {{"HTTP_ACCEPT", "application/json"}});
+    BOOST_REQUIRE_EQUAL(resp["status"], "HTTP/1.1 200 OK");
+    BOOST_REQUIRE_EQUAL(resp["Content-Type"], "application/json");
+    BOOST_REQUIRE_EQUAL(resp["Vary"], "Accept");
+    BOOST_REQUIRE_EQUAL(resp["body"], "[1.5,-2]");
+
+    // Plain encoding is preferred if acceptable
+    auto plain = conditional_get(*this, "/test/real_seq_ro", "", {{"HTTP_ACCEPT", "*/*"}});
+    BOOST_REQUIRE_EQUAL(plain["Content-Type"], "text/plain");
+    BOOST_REQUIRE_EQUAL(plain["body"].size(), 16u);
+
+    // Each representation has an entity tag of its own
+    BOOST_REQUIRE_NE(resp["ETag"], plain["ETag"]);
+    auto json = conditional_get(*this, "/test/real_seq_ro", plain["ETag"], {{"HTTP_ACCEPT", "application/json"}});
+    BOOST_REQUIRE_EQUAL(json["status"], "HTTP/1.1 200 OK");
+    BOOST_REQUIRE_EQUAL(json["ETag"], resp["ETag"]);
+
+    json = conditional_get(*this, "/test/real_seq_ro", resp["ETag"], {{"HTTP_ACCEPT", "application/json"}});
+    BOOST_REQUIRE_EQUAL(json["status"], "HTTP/1.1 304 Not Modified");
+    BOOST_REQUIRE_EQUAL(json["Vary"], "Accept");
+}
+
+BOOST_FIXTURE_TEST_CASE(get_cbor, fixture)
+{
+    managed_readonly_parameter<integer_t> integer_ro("integer_ro", &od, 1000);
+
+    auto resp =
+        conditional_get(*this, "/test/integer_ro", "", {{"HTTP_ACCEPT", "application/cbor, text/plain;q=0.5"}});
+    BOOST_REQUIRE_EQUAL(resp["status"], "HTTP/1.1 200 OK");
+    BOOST_REQUIRE_EQUAL(resp["Content-Type"], "application/cbor");
+    BOOST_REQUIRE_EQUAL(resp["body"], "\x19\x03\xe8");
+}
+
+BOOST_FIXTURE_TEST_CASE(benchmark_handler_threads, fixture)
+{
+    const std::size_t clients  = 4;
+    const std::size_t requests = 25;
+
+    managed_readonly_parameter<std::vector<double>> real_seq_ro(
+        "real_seq_ro", &od, std::vector<double>(10000, 1.0 / 3));
+
+    std::ostringstream request_oss;
+    request_oss << scgi_request({{"CONTENT_LENGTH", "0"},
+                                 {"SCGI", "1"},
+                                 {"REMOTE_PORT", "12345"},
+                                 {"REMOTE_ADDR", "127.0.0.1"},
+                                 {"REQUEST_URI", "/test/real_seq_ro"},
+                                 {"REQUEST_METHOD", "GET"}});
+    const std::string request = request_oss.str();
+
+    // Encoding the value dominates, which runs on per-connection strands and
+    // thus scales with the number of threads running the I/O service
+    const std::size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (std::size_t threads = 1; threads <= max_threads; threads *= 2) {
+        auto                     work = std::make_unique<asio::io_service::work>(io_service);
+        std::vector<std::thread> handler_threads;
+        for (std::size_t i = 0; i < threads; ++i)
+            handler_threads.emplace_back([this]() { io_service.run(); });
+
+        // Boost.Test assertions are not thread-safe
+        std::atomic<std::size_t> failures{0};
+
+        auto                     start = std::chrono::high_resolution_clock::now();
+        std::vector<std::thread> client_threads;
+        for (std::size_t i = 0; i < clients; ++i) {
+            client_threads.emplace_back([this, &request, &failures]() {
+                asio::io_service client_service;
+                for (std::size_t j = 0; j < requests; ++j) {
+                    asio::ip::tcp::socket sock(client_service);
+                    sock.connect(asio::ip::tcp::endpoint(asio::ip::address::from_string("127.0.0.1"), server.port()));
+                    asio::write(sock, asio::buffer(request));
+                    sock.shutdown(asio::ip::tcp::socket::shutdown_send);
+
+                    boost::system::error_code ec;
+                    asio::streambuf           response_buf;
+                    asio::read(sock, response_buf, ec);
+                    if (ec != asio::error::eof || response_buf.size() < 10000 * sizeof(double))
+                        ++failures;
+                }
+            });
+        }
+
+        for (auto& t : client_threads)
+            t.join();
+        auto duration = std::chrono::high_resolution_clock::now() - start;
+
+        work.reset();
+        io_service.stop();
+        for (auto& t : handler_threads)
+            t.join();
+        io_service.reset();
+
+        BOOST_REQUIRE_EQUAL(failures, 0u);
+        std::cout << "Serving " << clients * requests << " GET requests of a 10000 element real sequence to "
+                  << clients << " concurrent clients with " << threads << " handler thread(s) took "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() << " ms" << std::endl;
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+
+#include <scgi/byte_range.h>
+#include <boost/test/unit_test.hpp>
+
+using namespace decof;
+using namespace decof::scgi;
+
+BOOST_AUTO_TEST_SUITE(scgi_byte_range)
+
+BOOST_AUTO_TEST_CASE(parse)
+{
+    byte_range range;
+
+    BOOST_REQUIRE(parse_range("bytes=0-499", 1000, range) == range_result::satisfiable);
+    BOOST_CHECK_EQUAL(range.first, 0u);
+    BOOST_CHECK_EQUAL(range.last, 499u);
+
+    BOOST_REQUIRE(parse_range("bytes=900-", 1000, range) == range_result::satisfiable);
+    BOOST_CHECK_EQUAL(range.first, 900u);
+    BOOST_CHECK_EQUAL(range.last, 999u);
+
+    BOOST_REQUIRE(parse_range("bytes=990-2000", 1000, range) == range_result::satisfiable);
+    BOOST_CHECK_EQUAL(range.last, 999u);
+
+    BOOST_REQUIRE(parse_range("bytes=-100", 1000, range) == range_result::satisfiable);
+    BOOST_CHECK_EQUAL(range.first, 900u);
+    BOOST_CHECK_EQUAL(range.last, 999u);
+
+    BOOST_REQUIRE(parse_range("bytes=-2000", 1000, range) == range_result::satisfiable);
+    BOOST_CHECK_EQUAL(range.first, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(parse_unsatisfiable)
+{
+    byte_range range;
+
+    BOOST_CHECK(parse_range("bytes=1000-", 1000, range) == range_result::unsatisfiable);
+    BOOST_CHECK(parse_range("bytes=-0", 1000, range) == range_result::unsatisfiable);
+    BOOST_CHECK(parse_range("bytes=0-", 0, range) == range_result::unsatisfiable);
+}
+
+BOOST_AUTO_TEST_CASE(parse_ignored)
+{
+    byte_range range;
+
+    BOOST_CHECK(parse_range("items=0-1", 1000, range) == range_result::ignore);
+    BOOST_CHECK(parse_range("bytes=0-1,5-6", 1000, range) == range_result::ignore);
+    BOOST_CHECK(parse_range("bytes=5-1", 1000, range) == range_result::ignore);
+    BOOST_CHECK(parse_range("bytes=a-1", 1000, range) == range_result::ignore);
+    BOOST_CHECK(parse_range("bytes=", 1000, range) == range_result::ignore);
+}
+
+BOOST_AUTO_TEST_CASE(encoded_size)
+{
+    BOOST_CHECK_EQUAL(*range_encoded_size(scalar_t{binary_t{"abc"}}), 3u);
+    BOOST_CHECK_EQUAL(*range_encoded_size(sequence_t{integer_t{1}, integer_t{2}}), 8u);
+    BOOST_CHECK_EQUAL(*range_encoded_size(sequence_t{real_t{1.0}}), 8u);
+    BOOST_CHECK_EQUAL(*range_encoded_size(sequence_t{string_t{"ab"}}), 6u);
+    BOOST_CHECK(!range_encoded_size(scalar_t{integer_t{1}}));
+    BOOST_CHECK(!range_encoded_size(tuple_t{{integer_t{1}}}));
+}
+
+BOOST_AUTO_TEST_CASE(encode)
+{
+    BOOST_CHECK_EQUAL(encode_range(scalar_t{string_t{"Hello World"}}, {6, 10}), "World");
+
+    // From second byte of first to first byte of third element
+    BOOST_CHECK_EQUAL(encode_range(sequence_t{integer_t{256}, integer_t{2}, integer_t{3}}, {1, 8}),
+                      std::string("\x01\x00\x00\x02\x00\x00\x00\x03", 8));
+
+    BOOST_CHECK_EQUAL(encode_range(sequence_t{string_t{"ab"}, string_t{"cd"}}, {6, 9}), "2:cd");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
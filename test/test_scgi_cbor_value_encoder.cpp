@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+
+#include <scgi/cbor_value_encoder.h>
+#include <scgi/js_value_encoder.h>
+#include <scgi/json_value_encoder.h>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+#include <variant>
+
+using namespace decof;
+using namespace std::chrono;
+
+BOOST_AUTO_TEST_SUITE(scgi_cbor_value_encoder)
+
+namespace {
+
+std::string encode(const value_t& value)
+{
+    std::string              out;
+    scgi::cbor_value_encoder encoder(out);
+    std::visit(encoder, value);
+    return out;
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(scalars)
+{
+    BOOST_CHECK_EQUAL(encode(scalar_t{true}), "\xf5");
+    BOOST_CHECK_EQUAL(encode(scalar_t{false}), "\xf4");
+    BOOST_CHECK_EQUAL(encode(scalar_t{integer_t{10}}), "\x0a");
+    BOOST_CHECK_EQUAL(encode(scalar_t{integer_t{100}}), "\x18\x64");
+    BOOST_CHECK_EQUAL(encode(scalar_t{integer_t{1000}}), "\x19\x03\xe8");
+    BOOST_CHECK_EQUAL(encode(scalar_t{integer_t{-1000}}), "\x39\x03\xe7");
+    BOOST_CHECK_EQUAL(encode(scalar_t{integer_t{1000000000000}}),
+                      std::string("\x1b\x00\x00\x00\xe8\xd4\xa5\x10\x00", 9));
+    BOOST_CHECK_EQUAL(encode(scalar_t{real_t{1.1}}), "\xfb\x3f\xf1\x99\x99\x99\x99\x99\x9a");
+    BOOST_CHECK_EQUAL(encode(scalar_t{string_t{"IETF"}}), "\x64IETF");
+    BOOST_CHECK_EQUAL(encode(scalar_t{binary_t{std::string("\x01\x02\x03\x04", 4)}}), "\x44\x01\x02\x03\x04");
+}
+
+BOOST_AUTO_TEST_CASE(typed_arrays)
+{
+    BOOST_CHECK_EQUAL(encode(sequence_t{true, false}), std::string("\xd8\x40\x42\x01\x00", 5));
+    BOOST_CHECK_EQUAL(encode(sequence_t{integer_t{1}, integer_t{-1}}),
+                      std::string("\xd8\x4f\x50\x01\x00\x00\x00\x00\x00\x00\x00"
+                                  "\xff\xff\xff\xff\xff\xff\xff\xff",
+                                  19));
+    BOOST_CHECK_EQUAL(encode(sequence_t{real_t{1.0}}), std::string("\xd8\x57\x48\x00\x00\x00\x00\x00\x00\xf0\x3f", 11));
+}
+
+BOOST_AUTO_TEST_CASE(arrays)
+{
+    BOOST_CHECK_EQUAL(encode(sequence_t{}), "\x80");
+    BOOST_CHECK_EQUAL(encode(sequence_t{string_t{"a"}, string_t{"b"}}), "\x82\x61" "a" "\x61" "b");
+    BOOST_CHECK_EQUAL(encode(tuple_t{{true, integer_t{1}, string_t{"x"}}}), "\x83\xf5\x01\x61x");
+}
+
+BOOST_AUTO_TEST_CASE(benchmark)
+{
+    const std::size_t count = 100;
+
+    sequence_t seq;
+    for (std::size_t i = 0; i < 100000; ++i)
+        seq.push_back(real_t(i) / 7.0);
+    const value_t value = seq;
+
+    // Reference: the text/plain encoding on a string stream
+    std::size_t length = 0;
+    auto        start  = high_resolution_clock::now();
+    for (std::size_t i = 0; i < count; ++i) {
+        std::ostringstream out;
+        std::visit(scgi::js_value_encoder(out), value);
+        length += out.str().size();
+    }
+    auto js_duration = high_resolution_clock::now() - start;
+
+    std::string out;
+    start = high_resolution_clock::now();
+    for (std::size_t i = 0; i < count; ++i) {
+        out.clear();
+        scgi::json_value_encoder encoder(out);
+        std::visit(encoder, value);
+        length += out.size();
+    }
+    auto json_duration = high_resolution_clock::now() - start;
+
+    start = high_resolution_clock::now();
+    for (std::size_t i = 0; i < count; ++i) {
+        out.clear();
+        scgi::cbor_value_encoder encoder(out);
+        std::visit(encoder, value);
+        length += out.size();
+    }
+    auto cbor_duration = high_resolution_clock::now() - start;
+
+    BOOST_REQUIRE_GT(length, 0u);
+
+    std::cout << "Encoding " << count << " real sequences of " << seq.size() << " elements took "
+              << duration_cast<milliseconds>(js_duration).count() << " ms with scgi::js_value_encoder, "
+              << duration_cast<milliseconds>(json_duration).count() << " ms with scgi::json_value_encoder and "
+              << duration_cast<milliseconds>(cbor_duration).count() << " ms with scgi::cbor_value_encoder"
+              << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
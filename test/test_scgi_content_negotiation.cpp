@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+
+#include <scgi/content_negotiation.h>
+#include <boost/test/unit_test.hpp>
+
+using namespace decof::scgi;
+
+BOOST_AUTO_TEST_SUITE(scgi_content_negotiation)
+
+BOOST_AUTO_TEST_CASE(defaults)
+{
+    BOOST_CHECK_EQUAL(select_media_type("", {"text/plain", "application/json"}), 0u);
+    BOOST_CHECK_EQUAL(select_media_type("*/*", {"text/plain", "application/json"}), 0u);
+    BOOST_CHECK_EQUAL(select_media_type("image/png", {"text/plain", "application/json"}), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(quality)
+{
+    BOOST_CHECK_EQUAL(select_media_type("application/json", {"text/plain", "application/json"}), 1u);
+    BOOST_CHECK_EQUAL(select_media_type("text/plain;q=0.5, application/json", {"text/plain", "application/json"}), 1u);
+    BOOST_CHECK_EQUAL(select_media_type("application/*;q=0.8, */*;q=0.1", {"text/plain", "application/cbor"}), 1u);
+    BOOST_CHECK_EQUAL(select_media_type("application/cbor;q=0, */*", {"text/plain", "application/cbor"}), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(specificity)
+{
+    // The most specific media range determines the quality
+    BOOST_CHECK_EQUAL(
+        select_media_type("application/*, application/json;q=0.2", {"application/json", "application/cbor"}), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <scgi/json_value_encoder.h>
+#include <boost/test/unit_test.hpp>
+#include <limits>
+#include <string>
+#include <variant>
+
+using namespace decof;
+
+BOOST_AUTO_TEST_SUITE(scgi_json_value_encoder)
+
+namespace {
+
+std::string encode(const value_t& value)
+{
+    std::string              out;
+    scgi::json_value_encoder encoder(out);
+    std::visit(encoder, value);
+    return out;
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(scalars)
+{
+    BOOST_CHECK_EQUAL(encode(scalar_t{true}), "true");
+    BOOST_CHECK_EQUAL(encode(scalar_t{integer_t{-42}}), "-42");
+    BOOST_CHECK_EQUAL(encode(scalar_t{real_t{0.5}}), "0.5");
+    BOOST_CHECK_EQUAL(encode(scalar_t{real_t{0.1}}), "0.1");
+    BOOST_CHECK_EQUAL(encode(scalar_t{integer_t{-9223372036854775807LL - 1}}), "-9223372036854775808");
+    BOOST_CHECK_EQUAL(encode(scalar_t{std::numeric_limits<real_t>::quiet_NaN()}), "null");
+}
+
+BOOST_AUTO_TEST_CASE(string_escaping)
+{
+    BOOST_CHECK_EQUAL(encode(scalar_t{string_t{"a\"b\\c\r\n\x01"}}), "\"a\\\"b\\\\c\\r\\n\\u0001\"");
+}
+
+BOOST_AUTO_TEST_CASE(binary_base64)
+{
+    BOOST_CHECK_EQUAL(encode(scalar_t{binary_t{""}}), "\"\"");
+    BOOST_CHECK_EQUAL(encode(scalar_t{binary_t{"f"}}), "\"Zg==\"");
+    BOOST_CHECK_EQUAL(encode(scalar_t{binary_t{"fo"}}), "\"Zm8=\"");
+    BOOST_CHECK_EQUAL(encode(scalar_t{binary_t{"foo"}}), "\"Zm9v\"");
+    BOOST_CHECK_EQUAL(encode(scalar_t{binary_t{std::string("\xff\x00\x80\x01", 4)}}), "\"/wCAAQ==\"");
+}
+
+BOOST_AUTO_TEST_CASE(sequence_and_tuple)
+{
+    BOOST_CHECK_EQUAL(encode(sequence_t{}), "[]");
+    BOOST_CHECK_EQUAL(encode(sequence_t{{integer_t{1}, integer_t{2}}}), "[1,2]");
+    BOOST_CHECK_EQUAL(encode(tuple_t{{true, string_t{"x"}}}), "[true,\"x\"]");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
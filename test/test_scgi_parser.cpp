@@ -18,6 +18,9 @@
 
 #include <decof/scgi/request_parser.h>
 #include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <iostream>
+#include <string>
 
 BOOST_AUTO_TEST_SUITE(scgi_parser)
 
@@ -144,4 +147,108 @@ BOOST_FIXTURE_TEST_CASE(request_with_body, fixture)
     BOOST_REQUIRE_EQUAL(parser.body, "Hallo Welt");
 }
 
+namespace {
+
+/// Builds an SCGI request from header name/value pairs and body.
+std::string make_request(std::initializer_list<std::pair<std::string, std::string>> headers, const std::string& body)
+{
+    std::string netstring = "CONTENT_LENGTH" + std::string(1, '\0') + std::to_string(body.size()) + '\0' + "SCGI" +
+        '\0' + "1" + '\0';
+    for (const auto& header : headers)
+        netstring += header.first + '\0' + header.second + '\0';
+
+    return std::to_string(netstring.size()) + ":" + netstring + "," + body;
+}
+
+} // Anonymous namespace
+
+BOOST_FIXTURE_TEST_CASE(request_in_single_bytes, fixture)
+{
+    const std::string input =
+        make_request({{"REQUEST_URI", "/a/b"}, {"CONTENT_TYPE", "text/plain; utf-8"}}, "Hallo Welt");
+
+    decof::scgi::request_parser::result_type result = decof::scgi::request_parser::indeterminate;
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        BOOST_REQUIRE_EQUAL(result, decof::scgi::request_parser::indeterminate);
+        result = parser.parse(input.data() + i, input.data() + i + 1);
+    }
+
+    BOOST_REQUIRE_EQUAL(result, decof::scgi::request_parser::good);
+    BOOST_REQUIRE_EQUAL(parser.uri, "/a/b");
+    BOOST_REQUIRE_EQUAL(parser.content_type, "text/plain");
+    BOOST_REQUIRE_EQUAL(parser.encoding, "utf-8");
+    BOOST_REQUIRE_EQUAL(parser.body, "Hallo Welt");
+}
+
+BOOST_FIXTURE_TEST_CASE(bad_requests, fixture)
+{
+    const std::string inputs[] = {std::string("x:,"),
+                                  std::string("1234567890:"),
+                                  std::string("13:SCGI\0\0001\0\0,", 17),
+                                  std::string("24:CONTENT_LENGTH\0000\0SCGI\0002\0,", 30),
+                                  std::string("24:CONTENT_LENGTH\0000\0SCGI\0001\0;", 30),
+                                  std::string("22:CONTENT_LENGTH\0000\0SCGI\0001,", 28)};
+
+    for (const auto& input : inputs) {
+        parser.reset();
+        BOOST_REQUIRE_EQUAL(parser.parse(input.data(), input.data() + input.size()),
+                            decof::scgi::request_parser::bad);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(too_large_header, fixture)
+{
+    const std::string input = "65537:";
+    BOOST_REQUIRE_EQUAL(parser.parse(input.data(), input.data() + input.size()),
+                        decof::scgi::request_parser::too_large);
+
+    parser.reset();
+    const std::string limit = "65536:" + std::string(1000, 'x');
+    BOOST_REQUIRE_EQUAL(parser.parse(limit.data(), limit.data() + limit.size()),
+                        decof::scgi::request_parser::indeterminate);
+}
+
+BOOST_FIXTURE_TEST_CASE(unknown_header, fixture)
+{
+    const char input[] = "24:CONTENT_LENGTH\0000\0SCGI\0001\0,";
+    parser.parse(input, input + sizeof(input) - 1);
+
+    BOOST_REQUIRE_THROW(parser.headers.at("REQUEST_URI"), std::out_of_range);
+    BOOST_REQUIRE_EQUAL(parser.headers.count("SCGI"), 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(benchmark, fixture)
+{
+    for (std::size_t body_size : {std::size_t(0), std::size_t(1 << 20)}) {
+        // Typical GET request and PUT request with 1 MB body
+        const std::string request = make_request({{"SERVER_SOFTWARE", "lighttpd/1.4.33"},
+                                                  {"SERVER_NAME", "localhost"},
+                                                  {"REMOTE_PORT", "39997"},
+                                                  {"REMOTE_ADDR", "127.0.0.1"},
+                                                  {"REQUEST_URI", "/example/subnode/real_seq"},
+                                                  {"REQUEST_METHOD", body_size > 0 ? "PUT" : "GET"},
+                                                  {"HTTP_USER_AGENT", "curl/7.37.1"},
+                                                  {"HTTP_HOST", "localhost"},
+                                                  {"HTTP_ACCEPT", "*/*"},
+                                                  {"CONTENT_TYPE", "vnd/com.toptica.decof.real_seq"}},
+                                                 std::string(body_size, 'x'));
+        const std::size_t count   = body_size > 0 ? 200 : 200000;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (std::size_t i = 0; i < count; ++i) {
+            parser.reset();
+
+            // Feed in chunks as received from the socket
+            auto result = decof::scgi::request_parser::indeterminate;
+            for (std::size_t pos = 0; pos < request.size(); pos += 1500)
+                result = parser.parse(request.data() + pos, request.data() + std::min(request.size(), pos + 1500));
+            BOOST_REQUIRE_EQUAL(result, decof::scgi::request_parser::good);
+        }
+        auto duration = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start);
+
+        std::cout << "Parsing " << count << " SCGI requests with " << body_size << " bytes body: "
+                  << (count * request.size() / duration.count() / 1e6) << " MB/s" << std::endl;
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -64,6 +64,27 @@ BOOST_FIXTURE_TEST_CASE(response_with_header, fixture)
     BOOST_REQUIRE_EQUAL(ss.str(), result);
 }
 
+BOOST_FIXTURE_TEST_CASE(response_header_order, fixture)
+{
+    std::stringstream     ss;
+    decof::scgi::response resp   = decof::scgi::response::stock_response(decof::scgi::response::status_code::ok);
+    resp.headers["Vary"]         = "Accept";
+    resp.headers["Content-Type"] = "application/json";
+    resp.headers["ETag"]         = "\"1\"";
+    resp.headers["Vary"]         = "Accept-Encoding";
+    ss << resp;
+
+    // Headers are written in insertion order, assignments replace values
+    std::string result = "HTTP/1.1 200 OK\r\n"
+                         "Vary: Accept-Encoding\r\n"
+                         "Content-Type: application/json\r\n"
+                         "ETag: \"1\"\r\n"
+                         "Content-Length: 0\r\n\r\n";
+    BOOST_REQUIRE_EQUAL(ss.str(), result);
+    BOOST_REQUIRE_EQUAL(resp.headers.size(), 3u);
+    BOOST_REQUIRE(resp.headers.find("Content-Range") == resp.headers.end());
+}
+
 BOOST_FIXTURE_TEST_CASE(response_with_body, fixture)
 {
     std::stringstream     ss;
@@ -101,4 +122,72 @@ BOOST_FIXTURE_TEST_CASE(response_with_status_not_modified, fixture)
     BOOST_REQUIRE_EQUAL(ss.str(), result);
 }
 
+BOOST_AUTO_TEST_CASE(stock_bytes)
+{
+    using decof::scgi::response;
+
+    for (auto status : {response::status_code::ok,
+                        response::status_code::not_modified,
+                        response::status_code::bad_request,
+                        response::status_code::payload_too_large,
+                        response::status_code::space_unavailable}) {
+        std::stringstream ss;
+        ss << response::stock_response(status);
+        BOOST_CHECK_EQUAL(response::stock_bytes(status), ss.str());
+    }
+
+    // Preformatted once
+    BOOST_CHECK_EQUAL(
+        response::stock_bytes(response::status_code::ok).data(),
+        response::stock_bytes(response::status_code::ok).data());
+    BOOST_CHECK_THROW(response::stock_bytes(response::status_code::continue_), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(serialize_counts_header_as_copied)
+{
+    using decof::scgi::response;
+
+    response resp        = response::stock_response(response::status_code::ok);
+    resp.headers["ETag"] = "\"1\"";
+    resp.body            = "42";
+
+    const auto           header_size = resp.header().size();
+    decof::output_buffer buf;
+    resp.serialize(buf);
+
+    BOOST_CHECK_EQUAL(buf.bytes_copied(), header_size);
+    BOOST_CHECK_EQUAL(buf.bytes_referenced(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(serialize_with_header_buffer)
+{
+    using decof::scgi::response;
+
+    std::string header_buf;
+    header_buf.reserve(256);
+    const auto capacity = header_buf.capacity();
+
+    // Stock responses don't touch the header buffer
+    decof::output_buffer buf;
+    response             ack = response::stock_response(response::status_code::ok);
+    ack.serialize(buf, header_buf);
+    BOOST_CHECK(header_buf.empty());
+    BOOST_CHECK_EQUAL(buf.bytes_copied(), 0u);
+    buf.consume(buf.size());
+
+    response resp = response::stock_response(response::status_code::ok);
+    resp.headers["ETag"] = "\"1\"";
+    resp.body            = "42";
+    resp.serialize(buf, header_buf);
+
+    BOOST_CHECK_EQUAL(header_buf,
+                      "HTTP/1.1 200 OK\r\n"
+                      "ETag: \"1\"\r\n"
+                      "Content-Type: text/plain\r\n"
+                      "Content-Length: 2\r\n\r\n");
+    BOOST_CHECK_EQUAL(header_buf.capacity(), capacity);
+    BOOST_CHECK_EQUAL(buf.bytes_copied(), 0u);
+    BOOST_CHECK_EQUAL(buf.size(), header_buf.size() + 2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
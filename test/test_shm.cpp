@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+
+#include <decof/all.h>
+#include <decof/cli/pubsub_context.h>
+#include <decof/client_context/generic_tcp_server.h>
+#include <decof/shm/publisher.h>
+#include <decof/shm/subscriber.h>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <ctime>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(shm)
+
+using namespace decof;
+namespace asio = boost::asio;
+
+struct fixture
+{
+    explicit fixture(std::size_t capacity = 1 << 20)
+      : io_service(),
+        strand(io_service),
+        od("test"),
+        path(std::string(1, '\0') + "decof2-shm-test-" + std::to_string(::getpid())),
+        publisher(od, strand, asio::local::stream_protocol::endpoint(path), capacity),
+        real_param("real_param", &od, 1.5),
+        seq_param("seq_param", &od, std::vector<double>(100, 0.5))
+    {
+        publisher.preload();
+    }
+
+    /// Attaches a subscriber while the publisher's handlers are run.
+    std::unique_ptr<decof::shm::subscriber> attach()
+    {
+        auto future =
+            std::async(std::launch::async, [this]() { return std::make_unique<decof::shm::subscriber>(path); });
+        while (future.wait_for(std::chrono::milliseconds(1)) != std::future_status::ready)
+            io_service.poll();
+
+        return future.get();
+    }
+
+    asio::io_service         io_service;
+    asio::io_service::strand strand;
+    object_dictionary        od;
+    std::string              path;
+    decof::shm::publisher    publisher;
+
+    managed_readonly_parameter<double>              real_param;
+    managed_readonly_parameter<std::vector<double>> seq_param;
+};
+
+struct small_ring_fixture : fixture
+{
+    small_ring_fixture()
+      : fixture(4096)
+    {
+    }
+};
+
+BOOST_FIXTURE_TEST_CASE(current_values_on_attach, fixture)
+{
+    publisher.publish("test:real_param");
+
+    auto                           sub = attach();
+    decof::shm::subscriber::record rec;
+
+    BOOST_REQUIRE(sub->try_read(rec));
+    BOOST_REQUIRE_EQUAL(rec.uri, "test:real_param");
+    BOOST_REQUIRE(rec.value == value_t(1.5));
+    BOOST_REQUIRE_EQUAL(rec.sequence, 0u);
+    BOOST_REQUIRE(!sub->try_read(rec));
+
+    // Current values are delivered to the attaching subscriber only
+    auto other = attach();
+    BOOST_REQUIRE(other->try_read(rec));
+    BOOST_REQUIRE_EQUAL(rec.uri, "test:real_param");
+    BOOST_REQUIRE(!other->try_read(rec));
+    BOOST_REQUIRE(!sub->try_read(rec));
+}
+
+BOOST_FIXTURE_TEST_CASE(too_many_subscribers, fixture)
+{
+    std::vector<std::unique_ptr<decof::shm::subscriber>> subs;
+    for (std::size_t i = 0; i < decof::shm::max_consumers; ++i)
+        subs.push_back(attach());
+
+    // Surplus subscribers are rejected, but accepting continues
+    BOOST_REQUIRE_THROW(attach(), std::system_error);
+    BOOST_REQUIRE_THROW(attach(), std::system_error);
+
+    subs.erase(subs.begin());
+    io_service.poll();
+
+    publisher.publish("test:real_param");
+    subs.push_back(attach());
+
+    decof::shm::subscriber::record rec;
+    BOOST_REQUIRE(subs.back()->try_read(rec));
+    BOOST_REQUIRE_EQUAL(rec.uri, "test:real_param");
+}
+
+BOOST_FIXTURE_TEST_CASE(publish_changes, fixture)
+{
+    auto sub = attach();
+
+    publisher.publish("test");
+    real_param.value(2.5);
+    seq_param.value(std::vector<double>{1.0, 2.0});
+
+    // Initial values of both parameters followed by the changes
+    std::vector<decof::shm::subscriber::record> records(4);
+    for (auto& rec : records)
+        BOOST_REQUIRE(sub->try_read(rec));
+
+    decof::shm::subscriber::record rec;
+    BOOST_REQUIRE(!sub->try_read(rec));
+
+    BOOST_REQUIRE_EQUAL(records[2].uri, "test:real_param");
+    BOOST_REQUIRE(records[2].value == value_t(2.5));
+    BOOST_REQUIRE_EQUAL(records[3].uri, "test:seq_param");
+    BOOST_REQUIRE(records[3].value == value_t(sequence_t{1.0, 2.0}));
+    BOOST_REQUIRE_EQUAL(records[3].sequence, records[2].sequence + 1);
+    BOOST_REQUIRE_EQUAL(sub->lost(), 0u);
+
+    // Unpublished parameters are no longer written
+    publisher.unpublish("test");
+    real_param.value(3.5);
+    BOOST_REQUIRE(!sub->try_read(rec));
+}
+
+BOOST_FIXTURE_TEST_CASE(overrun, small_ring_fixture)
+{
+    publisher.publish("test:seq_param");
+    auto sub = attach();
+
+    decof::shm::subscriber::record rec;
+    BOOST_REQUIRE(sub->try_read(rec));
+
+    // Each record takes about 850 bytes of the 4096 bytes ring
+    for (int i = 0; i < 20; ++i)
+        seq_param.value(std::vector<double>(100, i));
+
+    // The subscriber resynchronizes with the most recent change
+    BOOST_REQUIRE(!sub->try_read(rec));
+    seq_param.value(std::vector<double>(100, 20.0));
+    BOOST_REQUIRE(sub->try_read(rec));
+    BOOST_REQUIRE(rec.value == value_t(sequence_t(100, 20.0)));
+    BOOST_REQUIRE_EQUAL(sub->lost(), 20u);
+
+    // Records larger than a quarter of the ring are dropped
+    seq_param.value(std::vector<double>(1000, 0.0));
+    BOOST_REQUIRE_EQUAL(publisher.dropped(), 1u);
+    BOOST_REQUIRE(!sub->try_read(rec));
+}
+
+BOOST_FIXTURE_TEST_CASE(wakeup, fixture)
+{
+    publisher.publish("test:real_param");
+    auto sub = attach();
+
+    decof::shm::subscriber::record rec;
+    BOOST_REQUIRE(sub->try_read(rec));
+    BOOST_REQUIRE(!sub->read(rec, std::chrono::milliseconds(0)));
+
+    // The publisher writes from another thread while the subscriber waits
+    std::thread producer([this]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        real_param.value(4.5);
+    });
+
+    BOOST_REQUIRE(sub->read(rec, std::chrono::seconds(5)));
+    BOOST_REQUIRE(rec.value == value_t(4.5));
+    producer.join();
+}
+
+BOOST_FIXTURE_TEST_CASE(benchmark, fixture)
+{
+    const std::size_t count = 10000;
+
+    generic_tcp_server<cli::pubsub_context> server(od, strand, asio::ip::tcp::endpoint(asio::ip::tcp::v4(), 0));
+    server.preload();
+
+    asio::ip::tcp::socket sock(io_service);
+    sock.connect(asio::ip::tcp::endpoint(asio::ip::address::from_string("127.0.0.1"), server.port()));
+    asio::write(sock, asio::buffer(std::string("subscribe real_param\n")));
+    io_service.poll();
+
+    asio::streambuf buf;
+    asio::read_until(sock, buf, '\n');
+    buf.consume(buf.size());
+
+    // Publish/subscribe over TCP
+    auto start     = std::chrono::high_resolution_clock::now();
+    auto cpu_start = std::clock();
+    for (std::size_t i = 0; i < count; ++i) {
+        real_param.value(i);
+        while (sock.available() == 0)
+            io_service.poll();
+
+        asio::read_until(sock, buf, '\n');
+        buf.consume(buf.size());
+    }
+    auto tcp_duration = std::chrono::high_resolution_clock::now() - start;
+    auto tcp_cpu      = std::clock() - cpu_start;
+    sock.close();
+    io_service.poll();
+
+    // Shared memory
+    publisher.publish("test:real_param");
+    auto sub = attach();
+
+    decof::shm::subscriber::record rec;
+    BOOST_REQUIRE(sub->try_read(rec));
+
+    start     = std::chrono::high_resolution_clock::now();
+    cpu_start = std::clock();
+    for (std::size_t i = 0; i < count; ++i) {
+        real_param.value(i);
+        BOOST_REQUIRE(sub->try_read(rec));
+    }
+    auto shm_duration = std::chrono::high_resolution_clock::now() - start;
+    auto shm_cpu      = std::clock() - cpu_start;
+
+    using std::chrono::nanoseconds;
+    std::cout << "Delivering " << count << " real parameter changes took "
+              << std::chrono::duration_cast<nanoseconds>(tcp_duration).count() / count << " ns and "
+              << (tcp_cpu * 1000000000 / CLOCKS_PER_SEC) / count << " ns CPU each with cli::pubsub_context and "
+              << std::chrono::duration_cast<nanoseconds>(shm_duration).count() / count << " ns and "
+              << (shm_cpu * 1000000000 / CLOCKS_PER_SEC) / count << " ns CPU each with shm::publisher" << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
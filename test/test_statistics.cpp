@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define BOOST_TEST_DYN_LINK
+
+#include "test_helpers.h"
+#include <decof/all.h>
+#include <decof/client_context/client_context.h>
+#include <decof/statistics.h>
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(framework_statistics)
+
+using namespace decof;
+
+namespace {
+
+struct context_t : public client_context
+{
+    using client_context::client_context;
+
+    void observe(const std::string& uri, value_change_slot slot)
+    {
+        client_context::observe(object_dictionary_.find_object(uri), slot);
+    }
+
+    void tick()
+    {
+        client_context::tick();
+    }
+};
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(collect_counters_of_all_threads)
+{
+    const auto before = statistics::collect();
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([]() {
+            for (int j = 0; j < 1000; ++j) {
+                statistics::count_request(request_type::get);
+                statistics::count_bytes_in(protocol_type::scgi, 10);
+            }
+        });
+    }
+
+    // Counters of running threads are collected as well
+    statistics::add_connections(3);
+    for (auto& thread : threads)
+        thread.join();
+
+    const auto after = statistics::collect();
+    BOOST_REQUIRE_EQUAL(after.requests[0] - before.requests[0], 4000u);
+    BOOST_REQUIRE_EQUAL(after.bytes_in[2] - before.bytes_in[2], 40000u);
+    BOOST_REQUIRE_EQUAL(after.connections - before.connections, 3);
+
+    statistics::add_connections(-3);
+}
+
+BOOST_AUTO_TEST_CASE(latency_percentiles)
+{
+    std::array<std::uint64_t, statistics::latency_buckets> latencies{};
+    BOOST_REQUIRE_EQUAL(statistics::latency_percentile(latencies, 0.5), 0.0);
+
+    // 90 latencies in [8, 16) us and 10 in [1024, 2048) us
+    latencies[4]  = 90;
+    latencies[11] = 10;
+
+    BOOST_REQUIRE_CLOSE(statistics::latency_percentile(latencies, 0.45), 12.0, 0.001);
+    BOOST_REQUIRE_CLOSE(statistics::latency_percentile(latencies, 0.9), 16.0, 0.001);
+    BOOST_REQUIRE_CLOSE(statistics::latency_percentile(latencies, 0.95), 1536.0, 0.001);
+}
+
+BOOST_AUTO_TEST_CASE(subscribe_to_statistics_node)
+{
+    object_dictionary od;
+    statistics_node   stats("stats", &od, std::chrono::seconds(0));
+    auto              context = std::make_shared<context_t>(od);
+
+    value_t rate;
+    context->observe("root:stats:requests-per-second:set", [&rate](const std::string&, const value_t& value) {
+        rate = value;
+    });
+    BOOST_REQUIRE_EQUAL(rate, value_t(0.0));
+
+    auto param = dynamic_cast<client_read_interface*>(od.find_object("root:stats:tick-targets"));
+    BOOST_REQUIRE(param != nullptr);
+    BOOST_REQUIRE_EQUAL(param->generic_value(), value_t(integer_t(1)));
+
+    for (int i = 0; i < 10; ++i)
+        statistics::count_request(request_type::set);
+    context->tick();
+
+    BOOST_REQUIRE_GT(std::get<real_t>(std::get<scalar_t>(rate)), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(benchmark_counting)
+{
+    constexpr int threads = 4;
+    constexpr int count   = 1000000;
+
+    auto measure = [](auto f) {
+        const auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> workers;
+        for (int i = 0; i < threads; ++i) {
+            workers.emplace_back([f]() {
+                for (int j = 0; j < count; ++j)
+                    f();
+            });
+        }
+        for (auto& worker : workers)
+            worker.join();
+
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() /
+            (threads * count);
+    };
+
+    std::atomic<std::uint64_t> shared{0};
+    const auto                 shared_ns =
+        measure([&shared]() { shared.fetch_add(1, std::memory_order_relaxed); });
+    const auto per_thread_ns = measure([]() { statistics::count_request(request_type::get); });
+
+    std::cout << "Counting a request on " << threads << " threads: " << per_thread_ns
+              << " ns with per-thread counters, " << shared_ns << " ns with a shared atomic counter\n";
+}
+
+BOOST_AUTO_TEST_SUITE_END()
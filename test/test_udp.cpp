@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2026 Florian Behrens
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#define BOOST_TEST_DYN_LINK
+
+#include <decof/all.h>
+#include <decof/udp/datagram.h>
+#include <decof/udp/publisher.h>
+#include <boost/asio/ip/multicast.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/test/unit_test.hpp>
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(udp)
+
+using namespace decof;
+namespace asio = boost::asio;
+
+struct fixture
+{
+    fixture()
+      : io_service(),
+        strand(io_service),
+        od("test"),
+        sock(io_service, asio::ip::udp::endpoint(asio::ip::address::from_string("127.0.0.1"), 0)),
+        publisher(od, strand, sock.local_endpoint()),
+        real_param("real_param", &od, 1.5),
+        int_param("int_param", &od, 1),
+        receiver([this](const std::string& uri, const value_t& value) { values.emplace_back(uri, value); })
+    {
+    }
+
+    /// Runs the publisher's handlers and returns the datagrams received.
+    std::vector<std::string> datagrams()
+    {
+        // The I/O service stops whenever it runs out of work
+        io_service.reset();
+        io_service.poll();
+
+        std::vector<std::string> retval;
+        std::array<char, 65536>  buf;
+        while (sock.available() > 0)
+            retval.emplace_back(buf.data(), sock.receive(asio::buffer(buf)));
+
+        return retval;
+    }
+
+    /// Decodes all datagrams received.
+    void receive()
+    {
+        for (const auto& datagram : datagrams())
+            receiver.receive(datagram.data(), datagram.size());
+    }
+
+    asio::io_service         io_service;
+    asio::io_service::strand strand;
+    object_dictionary        od;
+    asio::ip::udp::socket    sock;
+    decof::udp::publisher    publisher;
+
+    managed_readonly_parameter<double>           real_param;
+    managed_readonly_parameter<int>              int_param;
+    decof::udp::receiver                         receiver;
+    std::vector<std::pair<std::string, value_t>> values;
+};
+
+BOOST_FIXTURE_TEST_CASE(publish_changes, fixture)
+{
+    publisher.publish("test");
+    receive();
+
+    // Initial values
+    BOOST_REQUIRE_EQUAL(values.size(), 2u);
+    BOOST_REQUIRE_EQUAL(publisher.sent(), 1u);
+
+    // Changes of the same handler are batched into a single datagram
+    real_param.value(2.5);
+    int_param.value(2);
+    real_param.value(3.5);
+    receive();
+
+    BOOST_REQUIRE_EQUAL(publisher.sent(), 2u);
+    BOOST_REQUIRE_EQUAL(values.size(), 5u);
+    BOOST_REQUIRE_EQUAL(values[2].first, "test:real_param");
+    BOOST_REQUIRE(values[2].second == value_t(2.5));
+    BOOST_REQUIRE_EQUAL(values[3].first, "test:int_param");
+    BOOST_REQUIRE(values[3].second == value_t(integer_t(2)));
+    BOOST_REQUIRE(values[4].second == value_t(3.5));
+    BOOST_REQUIRE_EQUAL(receiver.lost(), 0u);
+
+    // Unpublished parameters are no longer sent
+    publisher.unpublish("test:int_param");
+    int_param.value(3);
+    receive();
+    BOOST_REQUIRE_EQUAL(values.size(), 5u);
+}
+
+BOOST_FIXTURE_TEST_CASE(batch_size, fixture)
+{
+    publisher.publish("test:real_param");
+    receive();
+
+    publisher.batch_size(2);
+    for (int i = 0; i < 5; ++i)
+        real_param.value(i);
+
+    BOOST_REQUIRE_EQUAL(datagrams().size(), 3u);
+}
+
+BOOST_FIXTURE_TEST_CASE(max_datagram_size, fixture)
+{
+    publisher.publish("test:real_param");
+    receive();
+
+    // Each value record takes 14 bytes after the 12 bytes header
+    publisher.max_datagram_size(12 + 3 * 14);
+    for (int i = 0; i < 7; ++i)
+        real_param.value(i);
+
+    BOOST_REQUIRE_EQUAL(datagrams().size(), 3u);
+}
+
+BOOST_FIXTURE_TEST_CASE(oversized_records, fixture)
+{
+    publisher.publish("test:real_param");
+    receive();
+
+    // Records not fitting into a datagram on their own are dropped
+    publisher.max_datagram_size(12 + 13);
+    real_param.value(2.5);
+    BOOST_REQUIRE(datagrams().empty());
+    BOOST_REQUIRE_EQUAL(publisher.dropped(), 1u);
+
+    // Datagrams and batches are limited to what UDP and the u16 record
+    // count can take
+    publisher.max_datagram_size(1 << 20);
+    publisher.batch_size(1 << 20);
+    for (int i = 0; i < 5000; ++i)
+        real_param.value(i);
+    publisher.flush();
+
+    BOOST_REQUIRE_EQUAL(datagrams().size(), 2u);
+    BOOST_REQUIRE_EQUAL(publisher.send_errors(), 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(detect_gaps, fixture)
+{
+    publisher.publish("test:real_param");
+    receive();
+
+    std::vector<std::string> sent;
+    for (int i = 0; i < 3; ++i) {
+        real_param.value(i);
+        auto received = datagrams();
+        sent.insert(sent.end(), received.begin(), received.end());
+    }
+    BOOST_REQUIRE_EQUAL(sent.size(), 3u);
+
+    receiver.receive(sent[0].data(), sent[0].size());
+    receiver.receive(sent[2].data(), sent[2].size());
+    BOOST_REQUIRE_EQUAL(receiver.lost(), 1u);
+    BOOST_REQUIRE(values.back().second == value_t(2.0));
+}
+
+BOOST_FIXTURE_TEST_CASE(repeated_announcements, fixture)
+{
+    publisher.announce_interval(2);
+    publisher.publish("test:real_param");
+    datagrams();
+
+    // A receiver joining late learns the parameter id with the announcements
+    // following every second datagram
+    real_param.value(2.5);
+    receive();
+    BOOST_REQUIRE(values.empty());
+    BOOST_REQUIRE_EQUAL(receiver.unknown(), 1u);
+
+    real_param.value(3.5);
+    receive();
+    BOOST_REQUIRE_EQUAL(values.size(), 1u);
+    BOOST_REQUIRE(values.back().second == value_t(3.5));
+}
+
+BOOST_FIXTURE_TEST_CASE(multicast_loopback, fixture)
+{
+    const auto group = asio::ip::address::from_string("239.255.42.42");
+
+    asio::ip::udp::socket msock(io_service);
+    msock.open(asio::ip::udp::v4());
+    msock.set_option(asio::ip::udp::socket::reuse_address(true));
+    msock.bind(asio::ip::udp::endpoint(asio::ip::address_v4::any(), 0));
+
+    const auto                loopback = asio::ip::address_v4::loopback();
+    boost::system::error_code ec;
+    msock.set_option(asio::ip::multicast::join_group(group.to_v4(), loopback), ec);
+    if (ec) {
+        std::cout << "Skipping multicast test: " << ec.message() << std::endl;
+        return;
+    }
+
+    decof::udp::publisher mpublisher(od, strand, asio::ip::udp::endpoint(group, msock.local_endpoint().port()));
+    mpublisher.multicast_interface(loopback);
+    mpublisher.publish("test:real_param");
+    io_service.reset();
+    io_service.poll();
+
+    // Loopback multicast may be unavailable in restricted environments
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (msock.available() == 0 && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    if (msock.available() == 0) {
+        std::cout << "Skipping multicast test: no datagram received on loopback" << std::endl;
+        return;
+    }
+
+    std::array<char, 65536> buf;
+    const auto              size = msock.receive(asio::buffer(buf));
+    receiver.receive(buf.data(), size);
+    BOOST_REQUIRE_EQUAL(values.size(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()